@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <locale>
+#include <regex>
+#include <string>
+
+using namespace std;
+
+namespace {
+    // HTTP style header block, with the header names in the case clients tend to send
+    string make_headers(const size_t length) {
+        static constexpr const char* lines[] = {
+            "Host: example.com\r\n",
+            "User-Agent: Mozilla/5.0 (Windows NT 10.0; Win64; x64)\r\n",
+            "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n",
+            "ACCEPT-LANGUAGE: en-US,en;q=0.5\r\n",
+            "Accept-Encoding: gzip, deflate, br\r\n",
+            "connection: keep-alive\r\n",
+        };
+
+        string text;
+        for (size_t i = 0; text.size() < length; ++i) {
+            text += lines[i % size(lines)];
+        }
+
+        text.resize(length);
+        return text;
+    }
+
+    void ctype_tolower(benchmark::State& state) {
+        const auto& facet = use_facet<ctype<char>>(locale::classic());
+        const string text = make_headers(static_cast<size_t>(state.range(0)));
+        string buffer     = text;
+
+        for (auto _ : state) {
+            buffer = text;
+            facet.tolower(buffer.data(), buffer.data() + buffer.size());
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+
+    void ctype_toupper(benchmark::State& state) {
+        const auto& facet = use_facet<ctype<char>>(locale::classic());
+        const string text = make_headers(static_cast<size_t>(state.range(0)));
+        string buffer     = text;
+
+        for (auto _ : state) {
+            buffer = text;
+            facet.toupper(buffer.data(), buffer.data() + buffer.size());
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+
+    void regex_search_icase(benchmark::State& state, const char* const pattern) {
+        string text = make_headers(static_cast<size_t>(state.range(0)));
+        text += "\r\nTransfer-Encoding: chunked\r\n";
+        const regex re{pattern, regex::icase};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(text);
+            const bool found = regex_search(text, re);
+            benchmark::DoNotOptimize(found);
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+
+    void regex_match_icase(benchmark::State& state, const char* const pattern) {
+        const string name = "accept-encoding: GZIP, DEFLATE, BR";
+        const regex re{pattern, regex::icase};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(name);
+            const bool matched = regex_match(name, re);
+            benchmark::DoNotOptimize(matched);
+        }
+    }
+} // unnamed namespace
+
+BENCHMARK(ctype_tolower)->Arg(32)->Arg(512)->Arg(8192);
+BENCHMARK(ctype_toupper)->Arg(32)->Arg(512)->Arg(8192);
+
+BENCHMARK_CAPTURE(regex_search_icase, "transfer-encoding", "transfer-encoding")->Arg(512)->Arg(8192);
+BENCHMARK_CAPTURE(regex_search_icase, "TRANSFER-ENCODING: \\w+", "TRANSFER-ENCODING: \\w+")->Arg(512)->Arg(8192);
+BENCHMARK_CAPTURE(regex_match_icase, "Accept-Encoding: gzip, deflate, br", "Accept-Encoding: gzip, deflate, br");
+BENCHMARK_CAPTURE(regex_match_icase, "(accept-encoding): .*", "(accept-encoding): .*");
+
+BENCHMARK_MAIN();
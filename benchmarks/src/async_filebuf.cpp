@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    const string path = (filesystem::temp_directory_path() / "async_filebuf_benchmark.log").string();
+
+    constexpr string_view log_line = "2024-01-01T00:00:00.000Z INFO [worker-7] request completed status=200\n";
+
+    // Measures how long the producer is blocked per line, which is what a logging thread cares about.
+    void write_lines(benchmark::State& state, ostream& os) {
+        const auto line_count = static_cast<size_t>(state.range(0));
+        vector<int64_t> latencies(line_count);
+        for (auto _ : state) {
+            for (auto& latency : latencies) {
+                const auto start = chrono::steady_clock::now();
+                os.write(log_line.data(), static_cast<streamsize>(log_line.size()));
+                latency = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+            }
+
+            os.flush();
+        }
+
+        sort(latencies.begin(), latencies.end());
+        state.counters["p50_ns"] = static_cast<double>(latencies[line_count / 2]);
+        state.counters["p99_ns"] = static_cast<double>(latencies[line_count - line_count / 100 - 1]);
+        state.counters["max_ns"] = static_cast<double>(latencies.back());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(line_count * log_line.size()));
+    }
+
+    void write_ofstream(benchmark::State& state) {
+        {
+            ofstream file(path, ios::binary);
+            write_lines(state, file);
+        }
+
+        remove(path.c_str());
+    }
+
+    void write_async_filebuf(benchmark::State& state) {
+        {
+            stdext::async_filebuf buf;
+            buf.open(path.c_str(), ios::out | ios::binary);
+            ostream file(&buf);
+            write_lines(state, file);
+        }
+
+        remove(path.c_str());
+    }
+} // unnamed namespace
+
+BENCHMARK(write_ofstream)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(write_async_filebuf)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
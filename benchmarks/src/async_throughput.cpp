@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    int tiny_task(const int value) {
+        return value * 3 + 1;
+    }
+
+    // many small tasks launched from one thread, then collected
+    void launch_and_collect(benchmark::State& state) {
+        const auto count = static_cast<size_t>(state.range(0));
+        vector<future<int>> futures;
+        futures.reserve(count);
+        for (auto _ : state) {
+            for (size_t i = 0; i < count; ++i) {
+                futures.push_back(async(launch::async, tiny_task, static_cast<int>(i)));
+            }
+
+            for (auto& fut : futures) {
+                benchmark::DoNotOptimize(fut.get());
+            }
+
+            futures.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    }
+
+    // small tasks launched by a task, which stay in its worker's queue unless another worker steals them
+    void launch_from_task(benchmark::State& state) {
+        const auto count = static_cast<size_t>(state.range(0));
+        for (auto _ : state) {
+            auto futures = async(launch::async, [count] {
+                vector<future<int>> inner;
+                inner.reserve(count);
+                for (size_t i = 0; i < count; ++i) {
+                    inner.push_back(async(launch::async, tiny_task, static_cast<int>(i)));
+                }
+
+                return inner;
+            }).get();
+
+            for (auto& fut : futures) {
+                benchmark::DoNotOptimize(fut.get());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    }
+} // unnamed namespace
+
+BENCHMARK(launch_and_collect)->Arg(1'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(launch_from_task)->Arg(1'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
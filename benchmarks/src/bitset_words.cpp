@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+using namespace std;
+
+template <size_t N>
+bitset<N> random_bitset() {
+    mt19937_64 rnd{};
+    array<uint64_t, N / 64> arr;
+    for (auto& d : arr) {
+        d = rnd() & rnd(); // a sparse-ish filter mask
+    }
+    return bit_cast<bitset<N>>(arr);
+}
+
+template <size_t N>
+void bm_and(benchmark::State& state) {
+    auto left        = random_bitset<N>();
+    const auto right = ~random_bitset<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        left &= right;
+        benchmark::DoNotOptimize(left);
+    }
+}
+
+template <size_t N>
+void bm_xor(benchmark::State& state) {
+    auto left        = random_bitset<N>();
+    const auto right = random_bitset<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        left ^= right;
+        benchmark::DoNotOptimize(left);
+    }
+}
+
+template <size_t N>
+void bm_count(benchmark::State& state) {
+    auto bits = random_bitset<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bits);
+        benchmark::DoNotOptimize(bits.count());
+    }
+}
+
+template <size_t N>
+void bm_none(benchmark::State& state) {
+    bitset<N> bits;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bits);
+        benchmark::DoNotOptimize(bits.none());
+    }
+}
+
+template <size_t N>
+void bm_shift_left(benchmark::State& state) {
+    const auto bits  = random_bitset<N>();
+    const auto shift = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        auto copy = bits;
+        benchmark::DoNotOptimize(copy);
+        copy <<= shift;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+template <size_t N>
+void bm_shift_right(benchmark::State& state) {
+    const auto bits  = random_bitset<N>();
+    const auto shift = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        auto copy = bits;
+        benchmark::DoNotOptimize(copy);
+        copy >>= shift;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+template <size_t N>
+void bm_for_each_set_bit(benchmark::State& state) {
+    const auto bits = random_bitset<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bits);
+        size_t sum = 0;
+        stdext::for_each_set_bit(bits, [&](const size_t pos) { sum += pos; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(bm_and<4096>);
+BENCHMARK(bm_and<65536>);
+BENCHMARK(bm_xor<4096>);
+BENCHMARK(bm_xor<65536>);
+BENCHMARK(bm_count<4096>);
+BENCHMARK(bm_count<65536>);
+BENCHMARK(bm_none<4096>);
+BENCHMARK(bm_none<65536>);
+BENCHMARK(bm_shift_left<4096>)->Arg(1)->Arg(64)->Arg(1000);
+BENCHMARK(bm_shift_left<65536>)->Arg(1)->Arg(64)->Arg(1000);
+BENCHMARK(bm_shift_right<4096>)->Arg(1)->Arg(64)->Arg(1000);
+BENCHMARK(bm_shift_right<65536>)->Arg(1)->Arg(64)->Arg(1000);
+BENCHMARK(bm_for_each_set_bit<4096>);
+BENCHMARK(bm_for_each_set_bit<65536>);
+
+BENCHMARK_MAIN();
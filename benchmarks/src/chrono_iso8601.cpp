@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+using namespace std;
+using namespace std::chrono;
+
+namespace {
+    // Timestamps 1 hour 1 minute 1.001 seconds apart, so that every field changes from one to the next
+    constexpr size_t timestamp_count = 4096;
+    constexpr auto stride            = hours{1} + minutes{1} + milliseconds{1001};
+    const sys_time<milliseconds> first_time{sys_days{2024y / January / 1}};
+
+    template <class Duration>
+    void format_timestamps(benchmark::State& state) {
+        char buffer[64];
+        auto time = time_point_cast<Duration>(first_time);
+        for (auto _ : state) {
+            const auto end = format_to(begin(buffer), "{:%FT%TZ}", time);
+            benchmark::DoNotOptimize(buffer);
+            benchmark::DoNotOptimize(end);
+            time += duration_cast<Duration>(stride);
+        }
+
+        state.counters["timestamps"] =
+            benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+
+    template <class Duration>
+    void parse_timestamps(benchmark::State& state) {
+        string text;
+        auto time = time_point_cast<Duration>(first_time);
+        for (size_t i = 0; i < timestamp_count; ++i) {
+            format_to(back_inserter(text), "{:%FT%TZ},", time);
+            time += duration_cast<Duration>(stride);
+        }
+
+        istringstream stream{text};
+        sys_time<Duration> parsed;
+        size_t parsed_count = 0;
+        for (auto _ : state) {
+            stream >> parse("%FT%TZ,", parsed);
+            benchmark::DoNotOptimize(parsed);
+            if (++parsed_count == timestamp_count) {
+                stream.seekg(0);
+                parsed_count = 0;
+            }
+        }
+
+        state.counters["timestamps"] =
+            benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+} // unnamed namespace
+
+BENCHMARK(format_timestamps<seconds>);
+BENCHMARK(format_timestamps<milliseconds>);
+BENCHMARK(parse_timestamps<seconds>);
+BENCHMARK(parse_timestamps<milliseconds>);
+
+BENCHMARK_MAIN();
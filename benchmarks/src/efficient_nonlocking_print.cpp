@@ -5,6 +5,7 @@
 // --benchmark_out=efficient_nonlocking_print.log --benchmark_out_format=console
 
 #include <benchmark/benchmark.h>
+#include <cstdint>
 #include <cstdio>
 #include <format>
 #include <print>
@@ -39,4 +40,31 @@ void BM_vprint_complex(benchmark::State& state) {
 BENCHMARK(BM_vprint_complex<&std::vprint_unicode>);
 BENCHMARK(BM_vprint_complex<&std::vprint_unicode_buffered>);
 
+constexpr int lines_per_record = 32;
+
+void BM_println_per_line(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < lines_per_record; ++i) {
+            std::println(stdout, "thread {} line {}: request completed status={}", state.thread_index(), i, 200);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lines_per_record));
+}
+BENCHMARK(BM_println_per_line)->ThreadRange(1, 32)->UseRealTime();
+
+void BM_println_batched(benchmark::State& state) {
+    stdext::print_batch batch;
+    for (auto _ : state) {
+        for (int i = 0; i < lines_per_record; ++i) {
+            batch.println("thread {} line {}: request completed status={}", state.thread_index(), i, 200);
+        }
+
+        batch.flush(stdout);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lines_per_record));
+}
+BENCHMARK(BM_println_batched)->ThreadRange(1, 32)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+namespace {
+    const string path = (filesystem::temp_directory_path() / "filebuf_lines_benchmark.log").string();
+
+    constexpr string_view log_line = "2024-01-01T00:00:00.000Z INFO [worker-7] request completed status=200";
+
+    void write_lines(benchmark::State& state) {
+        const auto line_count = static_cast<size_t>(state.range(0));
+        const auto buffer     = static_cast<streamsize>(state.range(1));
+        for (auto _ : state) {
+            ofstream file(path);
+            if (buffer != 0) {
+                file.rdbuf()->pubsetbuf(nullptr, buffer);
+            }
+
+            for (size_t i = 0; i < line_count; ++i) {
+                file << log_line << '\n';
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(line_count * (log_line.size() + 1)));
+        remove(path.c_str());
+    }
+
+    void read_lines(benchmark::State& state) {
+        const auto line_count = static_cast<size_t>(state.range(0));
+        {
+            ofstream file(path);
+            for (size_t i = 0; i < line_count; ++i) {
+                file << log_line << '\n';
+            }
+        }
+
+        string line;
+        for (auto _ : state) {
+            ifstream file(path);
+            while (getline(file, line)) {
+                benchmark::DoNotOptimize(line.data());
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(line_count * (log_line.size() + 1)));
+        remove(path.c_str());
+    }
+} // unnamed namespace
+
+// The second argument is the C stream buffer requested with pubsetbuf(nullptr, size); 0 keeps the CRT's default.
+BENCHMARK(write_lines)
+    ->Args({1'000'000, 0})
+    ->Args({1'000'000, 0x10000})
+    ->Args({10'000'000, 0})
+    ->Args({10'000'000, 0x10000})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(read_lines)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+
+#include "lorem.hpp"
+
+using namespace std;
+
+namespace {
+    class test_file {
+    public:
+        test_file() {
+            ofstream file(path, ios::binary);
+            for (size_t written = 0; written < 8 << 20; written += lorem_ipsum.size() + 1) {
+                file.write(lorem_ipsum.data(), static_cast<streamsize>(lorem_ipsum.size()));
+                file.put('\n');
+            }
+        }
+
+        test_file(const test_file&)            = delete;
+        test_file& operator=(const test_file&) = delete;
+
+        ~test_file() {
+            remove(path.c_str());
+        }
+
+        const string path = (filesystem::temp_directory_path() / "filebuf_read_benchmark.txt").string();
+    };
+
+    const test_file file;
+
+    void open_input(ifstream& stream, const bool mapped) {
+        if (mapped) {
+            stdext::open_mapped(*stream.rdbuf(), file.path);
+        } else {
+            stream.open(file.path, ios::binary);
+        }
+    }
+
+    template <bool Mapped>
+    void read_whole(benchmark::State& state) {
+        string buffer(static_cast<size_t>(filesystem::file_size(file.path)), '\0');
+        for (auto _ : state) {
+            ifstream stream;
+            open_input(stream, Mapped);
+            stream.read(buffer.data(), static_cast<streamsize>(buffer.size()));
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+
+    template <bool Mapped>
+    void read_lines(benchmark::State& state) {
+        string line;
+        for (auto _ : state) {
+            ifstream stream;
+            open_input(stream, Mapped);
+            while (getline(stream, line)) {
+                benchmark::DoNotOptimize(line.data());
+            }
+        }
+    }
+
+    template <bool Mapped>
+    void read_iterator(benchmark::State& state) {
+        for (auto _ : state) {
+            ifstream stream;
+            open_input(stream, Mapped);
+            size_t lines = 0;
+            for (istreambuf_iterator<char> it{stream}, last; it != last; ++it) {
+                lines += *it == '\n';
+            }
+
+            benchmark::DoNotOptimize(lines);
+        }
+    }
+} // unnamed namespace
+
+BENCHMARK(read_whole<false>);
+BENCHMARK(read_whole<true>);
+BENCHMARK(read_lines<false>);
+BENCHMARK(read_lines<true>);
+BENCHMARK(read_iterator<false>);
+BENCHMARK(read_iterator<true>);
+
+BENCHMARK_MAIN();
@@ -1,9 +1,15 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <atomic>
 #include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <string>
 #include <system_error>
+#include <vector>
 
 void symlink_status(benchmark::State& state) {
     auto path = std::filesystem::temp_directory_path();
@@ -19,4 +25,77 @@ void symlink_status(benchmark::State& state) {
 
 BENCHMARK(symlink_status);
 
+namespace {
+    // 16 top-level directories, each with 16 subdirectories of 64 files: 17,680 entries in all
+    class synthetic_tree {
+    public:
+        synthetic_tree() {
+            for (int i = 0; i < 16; ++i) {
+                for (int j = 0; j < 16; ++j) {
+                    const auto dir = root / std::to_string(i) / std::to_string(j);
+                    std::filesystem::create_directories(dir);
+                    for (int k = 0; k < 64; ++k) {
+                        std::ofstream{dir / ("file" + std::to_string(k) + ".bin")} << k;
+                    }
+                }
+            }
+        }
+
+        synthetic_tree(const synthetic_tree&)            = delete;
+        synthetic_tree& operator=(const synthetic_tree&) = delete;
+
+        ~synthetic_tree() {
+            std::error_code ec;
+            std::filesystem::remove_all(root, ec);
+        }
+
+        const std::filesystem::path root = std::filesystem::temp_directory_path() / "filesystem_benchmark_tree";
+    };
+
+    const synthetic_tree tree;
+
+    void walk_recursive_directory_iterator(benchmark::State& state) {
+        std::size_t entries = 0;
+        for (auto _ : state) {
+            std::uintmax_t bytes = 0;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(tree.root)) {
+                if (entry.is_regular_file()) {
+                    bytes += entry.file_size();
+                }
+
+                ++entries;
+            }
+
+            benchmark::DoNotOptimize(bytes);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(entries));
+    }
+
+    void walk_parallel_directory_walk(benchmark::State& state) {
+        std::atomic<std::size_t> entries{0};
+        for (auto _ : state) {
+            std::atomic<std::uintmax_t> bytes{0};
+            stdext::parallel_directory_walk(tree.root, [&](const auto&, const auto& batch) {
+                std::uintmax_t batch_bytes = 0;
+                for (const auto& entry : batch) {
+                    if (entry.is_regular_file()) {
+                        batch_bytes += entry.file_size();
+                    }
+                }
+
+                bytes += batch_bytes;
+                entries += batch.size();
+            });
+
+            benchmark::DoNotOptimize(bytes.load());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(entries.load()));
+    }
+} // unnamed namespace
+
+BENCHMARK(walk_recursive_directory_iterator)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(walk_parallel_directory_walk)->Unit(benchmark::kMillisecond)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -97,17 +97,27 @@ BENCHMARK(bm<AlgType::str_member_first, wchar_t>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_first, wchar_t, L'\x03B1'>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_first, char32_t>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_first, char32_t, U'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_first, char32_t, U'\x1F600'>)->Apply(common_args);
 
 BENCHMARK(bm<AlgType::str_member_last, char>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_last, wchar_t>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_last, wchar_t, L'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_last, char32_t>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_last, char32_t, U'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_last, char32_t, U'\x1F600'>)->Apply(common_args);
 
 BENCHMARK(bm<AlgType::str_member_first_not, char>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_first_not, wchar_t>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_first_not, wchar_t, L'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_first_not, char32_t>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_first_not, char32_t, U'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_first_not, char32_t, U'\x1F600'>)->Apply(common_args);
 
 BENCHMARK(bm<AlgType::str_member_last_not, char>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_last_not, wchar_t>)->Apply(common_args);
 BENCHMARK(bm<AlgType::str_member_last_not, wchar_t, L'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_last_not, char32_t>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_last_not, char32_t, U'\x03B1'>)->Apply(common_args);
+BENCHMARK(bm<AlgType::str_member_last_not, char32_t, U'\x1F600'>)->Apply(common_args);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Telemetry-like samples: sensor readings around a few operating points, with occasional spikes.
+vector<double> make_telemetry(const size_t n) {
+    mt19937_64 prng;
+    normal_distribution<double> temperature{21.5, 0.8};
+    lognormal_distribution<double> latency{-6.0, 1.2};
+    uniform_real_distribution<double> ratio{0.0, 1.0};
+
+    vector<double> result;
+    result.reserve(n);
+    for (size_t i = 0; i != n; ++i) {
+        switch (i % 3) {
+        case 0:
+            result.push_back(temperature(prng));
+            break;
+        case 1:
+            result.push_back(latency(prng));
+            break;
+        default:
+            result.push_back(ratio(prng) * 1e6);
+            break;
+        }
+    }
+
+    return result;
+}
+
+template <const char* Fmt>
+void format_to_string(benchmark::State& state) {
+    const auto values = make_telemetry(4096);
+    string output;
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        output.clear();
+        for (const double value : values) {
+            format_to(back_inserter(output), Fmt, value);
+        }
+        bytes += output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+template <const char* Fmt>
+void format_to_buffer(benchmark::State& state) {
+    const auto values = make_telemetry(4096);
+    char buffer[2048];
+    size_t bytes = 0;
+
+    for (auto _ : state) {
+        for (const double value : values) {
+            const auto end = format_to(buffer, Fmt, value);
+            bytes += static_cast<size_t>(end - buffer);
+        }
+        benchmark::DoNotOptimize(buffer);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+constexpr char fmt_default[]   = "{} ";
+constexpr char fmt_fixed[]     = "{:.3f} ";
+constexpr char fmt_general[]   = "{:g} ";
+constexpr char fmt_padded[]    = "{:>16.3f} ";
+constexpr char fmt_localized[] = "{:L} ";
+
+BENCHMARK(format_to_string<fmt_default>);
+BENCHMARK(format_to_string<fmt_fixed>);
+BENCHMARK(format_to_string<fmt_general>);
+BENCHMARK(format_to_buffer<fmt_default>);
+BENCHMARK(format_to_buffer<fmt_fixed>);
+BENCHMARK(format_to_buffer<fmt_general>);
+BENCHMARK(format_to_string<fmt_padded>); // width disables the direct path
+BENCHMARK(format_to_string<fmt_localized>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    // set_value() followed by get() on the same thread; the future is always ready when it's read
+    void ready_round_trip(benchmark::State& state) {
+        int value = 0;
+        for (auto _ : state) {
+            promise<int> pr;
+            future<int> fut = pr.get_future();
+            pr.set_value(++value);
+            benchmark::DoNotOptimize(fut.get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // repeatedly reading an already satisfied shared state
+    void ready_shared_get(benchmark::State& state) {
+        promise<int> pr;
+        const shared_future<int> fut = pr.get_future().share();
+        pr.set_value(1729);
+        for (auto _ : state) {
+            fut.wait();
+            benchmark::DoNotOptimize(fut.get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // request/reply pairs bounced between two threads, as an RPC layer would
+    void cross_thread_round_trip(benchmark::State& state) {
+        const auto count = static_cast<size_t>(state.range(0));
+        for (auto _ : state) {
+            vector<promise<int>> requests(count);
+            vector<promise<int>> replies(count);
+            vector<future<int>> request_futures;
+            vector<future<int>> reply_futures;
+            request_futures.reserve(count);
+            reply_futures.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                request_futures.push_back(requests[i].get_future());
+                reply_futures.push_back(replies[i].get_future());
+            }
+
+            thread server{[&] {
+                for (size_t i = 0; i < count; ++i) {
+                    replies[i].set_value(request_futures[i].get() + 1);
+                }
+            }};
+
+            for (size_t i = 0; i < count; ++i) {
+                requests[i].set_value(static_cast<int>(i));
+                benchmark::DoNotOptimize(reply_futures[i].get());
+            }
+
+            server.join();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    }
+} // unnamed namespace
+
+BENCHMARK(ready_round_trip);
+BENCHMARK(ready_shared_get);
+BENCHMARK(cross_thread_round_trip)->Arg(1'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -4,6 +4,14 @@
 #include "benchmark/benchmark.h"
 #include <chrono>
 
+// Registered first, so that it measures the first use of the time zone database in the process.
+void cold_start(benchmark::State& state) {
+    for (auto _ : state) {
+        const auto tz = std::chrono::locate_zone("America/Los_Angeles");
+        benchmark::DoNotOptimize(tz->to_local(std::chrono::sys_seconds{}));
+    }
+}
+
 void locate_zone(benchmark::State& state) {
     const auto& db = std::chrono::get_tzdb();
     for (auto _ : state) {
@@ -14,6 +22,18 @@ void locate_zone(benchmark::State& state) {
     }
 }
 
+void locate_zone_link(benchmark::State& state) {
+    const auto& db = std::chrono::get_tzdb();
+    for (auto _ : state) {
+        for (const auto& l : db.links) {
+            auto res = db.locate_zone(l.name());
+            benchmark::DoNotOptimize(res);
+        }
+    }
+}
+
+BENCHMARK(cold_start)->Iterations(1)->Unit(benchmark::kMillisecond);
 BENCHMARK(locate_zone);
+BENCHMARK(locate_zone_link);
 
 BENCHMARK_MAIN();
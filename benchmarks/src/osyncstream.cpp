@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <streambuf>
+#include <string_view>
+#include <syncstream>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    // Discards its input, so that the benchmarks measure osyncstream itself.
+    class null_buffer : public streambuf {
+    protected:
+        int_type overflow(const int_type ch) override {
+            return traits_type::not_eof(ch);
+        }
+
+        streamsize xsputn(const char*, const streamsize count) override {
+            return count;
+        }
+    };
+
+    constexpr string_view log_line = "2024-01-01T00:00:00.000Z INFO [worker-7] request completed status=200\n";
+
+    null_buffer shared_buffer;
+    vector<null_buffer> own_buffers(64);
+
+    void emit_lines(benchmark::State& state, streambuf* const wrapped) {
+        for (auto _ : state) {
+            osyncstream{wrapped} << log_line;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(log_line.size()));
+    }
+
+    // Every thread logs to the same stream, like many threads writing to cout.
+    void osyncstream_shared(benchmark::State& state) {
+        emit_lines(state, &shared_buffer);
+    }
+
+    // Every thread logs to its own stream, so threads only contend inside osyncstream's bookkeeping.
+    void osyncstream_separate(benchmark::State& state) {
+        emit_lines(state, &own_buffers[static_cast<size_t>(state.thread_index())]);
+    }
+} // unnamed namespace
+
+BENCHMARK(osyncstream_shared)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(osyncstream_separate)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -2,12 +2,36 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdlib>
 #include <filesystem>
+#include <new>
 #include <string_view>
 
-void BM_lexically_normal(benchmark::State& state) {
+namespace {
+    std::size_t allocation_count = 0;
+} // unnamed namespace
+
+void* operator new(const std::size_t size) {
+    ++allocation_count;
+    if (void* const ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* const ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
     using namespace std::literals;
-    static constexpr std::wstring_view args[5]{
+    constexpr std::wstring_view args[5]{
         LR"(C:Snippets)"sv,
         LR"(.\Snippets)"sv,
         LR"(..\..\IDE\VC\Snippets)"sv,
@@ -15,13 +39,35 @@ void BM_lexically_normal(benchmark::State& state) {
         LR"(/\server/\share/\a/\b/\c/\./\./\d/\../\../\../\../\../\../\../\other/x/y/z/.././..\meow.txt)"sv,
     };
 
+    void report_allocations(benchmark::State& state, const std::size_t before) {
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(allocation_count - before), benchmark::Counter::kAvgIterations);
+    }
+} // unnamed namespace
+
+void BM_lexically_normal(benchmark::State& state) {
     const auto index = state.range(0);
     const std::filesystem::path p(args[index]);
+    const auto before = allocation_count;
     for (auto _ : state) {
         benchmark::DoNotOptimize(p.lexically_normal());
     }
+
+    report_allocations(state, before);
+}
+
+void BM_lexically_relative(benchmark::State& state) {
+    const std::filesystem::path base(LR"(C:\Program Files\Microsoft Visual Studio\2022\Community)"sv);
+    const std::filesystem::path p(args[3]);
+    const auto before = allocation_count;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p.lexically_relative(base));
+    }
+
+    report_allocations(state, before);
 }
 
 BENCHMARK(BM_lexically_normal)->DenseRange(0, 4, 1);
+BENCHMARK(BM_lexically_relative);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    constexpr size_t sample_count = 4096;
+
+    template <class Engine, class Dist, class Value = typename Dist::result_type>
+    void one_at_a_time(benchmark::State& state) {
+        Engine gen;
+        Dist dist;
+        vector<Value> values(sample_count);
+        for (auto _ : state) {
+            for (auto& value : values) {
+                value = dist(gen);
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.counters["samples"] =
+            benchmark::Counter(static_cast<double>(state.iterations() * sample_count), benchmark::Counter::kIsRate);
+    }
+
+    template <class Engine, class Dist, class Value = typename Dist::result_type>
+    void batched(benchmark::State& state) {
+        Engine gen;
+        Dist dist;
+        vector<Value> values(sample_count);
+        for (auto _ : state) {
+            stdext::generate_random(values.begin(), values.end(), gen, dist);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.counters["samples"] =
+            benchmark::Counter(static_cast<double>(state.iterations() * sample_count), benchmark::Counter::kIsRate);
+    }
+} // unnamed namespace
+
+BENCHMARK(one_at_a_time<mt19937, uniform_int_distribution<int>>);
+BENCHMARK(batched<mt19937, uniform_int_distribution<int>>);
+BENCHMARK(one_at_a_time<mt19937_64, uniform_int_distribution<long long>>);
+BENCHMARK(batched<mt19937_64, uniform_int_distribution<long long>>);
+BENCHMARK(one_at_a_time<mt19937, uniform_real_distribution<float>>);
+BENCHMARK(batched<mt19937, uniform_real_distribution<float>>);
+BENCHMARK(one_at_a_time<mt19937_64, uniform_real_distribution<double>>);
+BENCHMARK(batched<mt19937_64, uniform_real_distribution<double>>);
+BENCHMARK(one_at_a_time<mt19937, uniform_real_distribution<double>>);
+BENCHMARK(batched<mt19937, uniform_real_distribution<double>>);
+// vector<bool> isn't contiguous, so bernoulli_distribution's results are stored as chars
+BENCHMARK(one_at_a_time<mt19937_64, bernoulli_distribution, char>);
+BENCHMARK(batched<mt19937_64, bernoulli_distribution, char>);
+BENCHMARK(one_at_a_time<mt19937_64, normal_distribution<double>>);
+BENCHMARK(batched<mt19937_64, normal_distribution<double>>);
+BENCHMARK(one_at_a_time<mt19937_64, exponential_distribution<double>>);
+BENCHMARK(batched<mt19937_64, exponential_distribution<double>>);
+BENCHMARK(one_at_a_time<mt19937_64, poisson_distribution<int>>);
+BENCHMARK(batched<mt19937_64, poisson_distribution<int>>);
+
+BENCHMARK_MAIN();
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <benchmark/benchmark.h>
+#include <cstddef>
 #include <cstdint>
 #include <random>
+#include <vector>
 
 /// Test URBGs alone
 
@@ -46,6 +48,40 @@ BENCHMARK(BM_discard<std::mt19937>)->Range(0, 1 << 18);
 BENCHMARK(BM_discard<std::mt19937_64>)->Range(0, 1 << 18);
 BENCHMARK(BM_discard<std::minstd_rand>)->Range(0, 1 << 18);
 
+/// Test filling a buffer: scalar calls vs. stdext::generate_random()
+
+template <class Engine>
+void BM_fill_scalar(benchmark::State& state) {
+    Engine gen;
+    std::vector<typename Engine::result_type> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto& value : values) {
+            value = gen();
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.counters["values"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * state.range(0)), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_fill_scalar<std::mt19937>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_fill_scalar<std::mt19937_64>)->Arg(1 << 10)->Arg(1 << 16);
+
+template <class Engine>
+void BM_fill_bulk(benchmark::State& state) {
+    Engine gen;
+    std::vector<typename Engine::result_type> values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        stdext::generate_random(values.begin(), values.end(), gen);
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.counters["values"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * state.range(0)), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_fill_bulk<std::mt19937>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_fill_bulk<std::mt19937_64>)->Arg(1 << 10)->Arg(1 << 16);
+
 /// Support machinery for testing _Rng_from_urng_v2
 
 std::uint32_t GetMax() {
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace std;
+
+namespace {
+    template <class Dist>
+    void sample(benchmark::State& state) {
+        mt19937_64 gen;
+        Dist dist;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(dist(gen));
+        }
+
+        state.counters["samples"] =
+            benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+} // unnamed namespace
+
+BENCHMARK(sample<normal_distribution<double>>);
+BENCHMARK(sample<stdext::ziggurat_normal_distribution<double>>);
+BENCHMARK(sample<exponential_distribution<double>>);
+BENCHMARK(sample<stdext::ziggurat_exponential_distribution<double>>);
+BENCHMARK(sample<normal_distribution<float>>);
+BENCHMARK(sample<stdext::ziggurat_normal_distribution<float>>);
+
+BENCHMARK_MAIN();
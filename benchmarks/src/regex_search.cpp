@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <benchmark/benchmark.h>
+#include <cstddef>
 #include <regex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "lorem.hpp"
 
@@ -43,5 +46,102 @@ BENCHMARK_CAPTURE(bm_lorem_search, R"(\Bibe)", R"(\Bibe)")->Arg(2)->Arg(3)->Arg(
 BENCHMARK_CAPTURE(bm_lorem_search, R"((?=....)bibe)", R"((?=....)bibe)")->Arg(2)->Arg(3)->Arg(4);
 BENCHMARK_CAPTURE(bm_lorem_search, R"((?=bibe)....)", R"((?=bibe)....)")->Arg(2)->Arg(3)->Arg(4);
 BENCHMARK_CAPTURE(bm_lorem_search, R"((?!lorem)bibe)", R"((?!lorem)bibe)")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, R"(\w+ bibendum)", R"(\w+ bibendum)")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, R"([a-z]{4}, bibendum)", R"([a-z]{4}, bibendum)")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, R"(\w\w\w\w bibendum)", R"(\w\w\w\w bibendum)")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, R"([a-z]+ (?:sit|est) amet)", R"([a-z]+ (?:sit|est) amet)")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, R"(\d+ ERROR)", R"(\d+ ERROR)")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, "[A-Za-z0-9_]+", "[A-Za-z0-9_]+")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, "[a-z]+m,", "[a-z]+m,")->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK_CAPTURE(bm_lorem_search, "[^.]+[.]", "[^.]+[.]")->Arg(2)->Arg(3)->Arg(4);
+
+// Log-scanning style: many short lines, few of which contain the literal.
+void bm_log_lines_search(benchmark::State& state, const char* pattern) {
+    vector<string> lines;
+    for (int i = 0; i < 4096; ++i) {
+        string line = "2024-01-01T00:00:" + to_string(i % 60) + " host" + to_string(i % 17) + " ";
+        line += (i % 97 == 0) ? "ERROR connection reset by peer" : "INFO request served in 12ms";
+        lines.push_back(move(line));
+    }
+    regex re{pattern};
+
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (const auto& line : lines) {
+            hits += regex_search(line, re);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+
+BENCHMARK_CAPTURE(bm_log_lines_search, "ERROR", "ERROR");
+BENCHMARK_CAPTURE(bm_log_lines_search, R"(host\d+ ERROR)", R"(host\d+ ERROR)");
+BENCHMARK_CAPTURE(bm_log_lines_search, R"(:\d\d host\d ERROR)", R"(:\d\d host\d ERROR)");
+BENCHMARK_CAPTURE(bm_log_lines_search, R"([A-Z]+ connection reset)", R"([A-Z]+ connection reset)");
+
+// Many short matches in one text: each one is a separate search.
+string make_short_lines(const long long count) {
+    string text;
+    for (long long i = 0; i < count; ++i) {
+        text += "key" + to_string(i % 1000) + "=value" + to_string(i % 7) + "\n";
+    }
+    return text;
+}
+
+void bm_short_lines_iterate(benchmark::State& state, const char* pattern) {
+    const string text = make_short_lines(state.range());
+    regex re{pattern};
+
+    for (auto _ : state) {
+        size_t count = 0;
+        for (sregex_iterator it{text.begin(), text.end(), re}, last; it != last; ++it) {
+            count += static_cast<size_t>(it->length(1));
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+void bm_short_lines_tokenize(benchmark::State& state, const char* pattern) {
+    const string text = make_short_lines(state.range());
+    regex re{pattern};
+
+    for (auto _ : state) {
+        size_t count = 0;
+        for (sregex_token_iterator it{text.begin(), text.end(), re, -1}, last; it != last; ++it) {
+            count += static_cast<size_t>(it->length());
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+void bm_short_lines_replace(benchmark::State& state, const char* pattern) {
+    const string text = make_short_lines(state.range());
+    regex re{pattern};
+
+    for (auto _ : state) {
+        string result = regex_replace(text, re, "$2:$1");
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_CAPTURE(bm_short_lines_iterate, R"((\w+)=(\w+))", R"((\w+)=(\w+))")->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_CAPTURE(bm_short_lines_tokenize, R"([=\n])", R"([=\n])")->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_CAPTURE(bm_short_lines_replace, R"((\w+)=(\w+))", R"((\w+)=(\w+))")->Arg(1 << 12)->Arg(1 << 20);
+
+// Patterns that backtrack heavily when the subject almost matches.
+void bm_nested_loops_match(benchmark::State& state, const char* pattern) {
+    const string subject(static_cast<size_t>(state.range()), 'a');
+    regex re{pattern};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(subject);
+        const bool matched = regex_match(subject, re);
+        benchmark::DoNotOptimize(matched);
+    }
+}
+
+BENCHMARK_CAPTURE(bm_nested_loops_match, "(a|aa)*b", "(a|aa)*b")->Arg(16)->Arg(24)->Arg(1024);
+BENCHMARK_CAPTURE(bm_nested_loops_match, "(a*)*b", "(a*)*b")->Arg(16)->Arg(24)->Arg(1024);
+BENCHMARK_CAPTURE(bm_nested_loops_match, "a*a*a*a*b", "a*a*a*a*b")->Arg(16)->Arg(24)->Arg(1024);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+
+using namespace std::chrono;
+
+namespace {
+    // One conversion every 17 minutes starting in 2000, so that runs of conversions cross DST transitions
+    constexpr seconds stride = minutes{17};
+    const sys_seconds first_time{sys_days{2000y / January / 1}};
+
+    void to_local(benchmark::State& state) {
+        const auto tz = locate_zone("America/Los_Angeles");
+        auto time     = first_time;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(tz->to_local(time));
+            time += stride;
+        }
+
+        state.counters["conversions"] =
+            benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+
+    void to_sys(benchmark::State& state) {
+        const auto tz = locate_zone("America/Los_Angeles");
+        auto time     = local_seconds{first_time.time_since_epoch()};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(tz->to_sys(time, choose::earliest));
+            time += stride;
+        }
+
+        state.counters["conversions"] =
+            benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+
+    void zoned_time_local(benchmark::State& state) {
+        const auto tz = locate_zone("Australia/Sydney");
+        auto time     = first_time;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(zoned_time{tz, time}.get_local_time());
+            time += stride;
+        }
+
+        state.counters["conversions"] =
+            benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    }
+} // unnamed namespace
+
+BENCHMARK(to_local);
+BENCHMARK(to_sys);
+BENCHMARK(zoned_time_local);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CODECVT_CHAR8_T_FACETS_DEPRECATION_WARNING
+
+#include <benchmark/benchmark.h>
+#include <codecvt>
+#include <cstddef>
+#include <cstdint>
+#include <cwchar>
+#include <filesystem>
+#include <locale>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+namespace {
+    enum class text_kind { ascii, latin, cjk };
+
+    // UTF-8 text of at least the given length, ending on a code point boundary
+    template <text_kind Kind>
+    u8string make_text(const size_t length) {
+        u8string_view sample;
+        switch (Kind) {
+        case text_kind::ascii:
+            sample = u8"C:\\Users\\Public\\Documents\\Reports\\quarterly_summary_2024.txt ";
+            break;
+        case text_kind::latin:
+            sample = u8"Größenmaßstäbe für Übersetzungen, déjà vu à la française, señor Núñez ";
+            break;
+        case text_kind::cjk:
+            sample = u8"東京都の天気は晴れです。明日は雨が降るでしょう。";
+            break;
+        }
+
+        u8string text;
+        while (text.size() < length) {
+            text += sample;
+        }
+
+        return text;
+    }
+
+    template <text_kind Kind>
+    void codecvt_in(benchmark::State& state) {
+        const auto& facet   = use_facet<codecvt<char16_t, char8_t, mbstate_t>>(locale::classic());
+        const u8string text = make_text<Kind>(static_cast<size_t>(state.range(0)));
+        u16string buffer(text.size(), u'\0');
+
+        for (auto _ : state) {
+            mbstate_t mb{};
+            const char8_t* from_next;
+            char16_t* to_next;
+            const auto result = facet.in(mb, text.data(), text.data() + text.size(), from_next, buffer.data(),
+                buffer.data() + buffer.size(), to_next);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+
+    template <text_kind Kind>
+    void codecvt_out(benchmark::State& state) {
+        const auto& facet   = use_facet<codecvt<char16_t, char8_t, mbstate_t>>(locale::classic());
+        const u8string text = make_text<Kind>(static_cast<size_t>(state.range(0)));
+        u16string wide(text.size(), u'\0');
+        {
+            mbstate_t mb{};
+            const char8_t* from_next;
+            char16_t* to_next;
+            (void) facet.in(
+                mb, text.data(), text.data() + text.size(), from_next, wide.data(), wide.data() + wide.size(), to_next);
+            wide.resize(static_cast<size_t>(to_next - wide.data()));
+        }
+
+        u8string buffer(text.size(), u8'\0');
+
+        for (auto _ : state) {
+            mbstate_t mb{};
+            const char16_t* from_next;
+            char8_t* to_next;
+            const auto result = facet.out(mb, wide.data(), wide.data() + wide.size(), from_next, buffer.data(),
+                buffer.data() + buffer.size(), to_next);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+
+    template <text_kind Kind>
+    void codecvt_utf8_utf16_in(benchmark::State& state) {
+        const codecvt_utf8_utf16<char16_t> facet;
+        const u8string text8 = make_text<Kind>(static_cast<size_t>(state.range(0)));
+        const string text(text8.begin(), text8.end());
+        u16string buffer(text.size(), u'\0');
+
+        for (auto _ : state) {
+            mbstate_t mb{};
+            const char* from_next;
+            char16_t* to_next;
+            const auto result = facet.in(mb, text.data(), text.data() + text.size(), from_next, buffer.data(),
+                buffer.data() + buffer.size(), to_next);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+
+    template <text_kind Kind>
+    void path_from_u8string(benchmark::State& state) {
+        const u8string text = make_text<Kind>(static_cast<size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(text);
+            filesystem::path p{text};
+            benchmark::DoNotOptimize(p);
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    }
+} // unnamed namespace
+
+BENCHMARK(codecvt_in<text_kind::ascii>)->Arg(64)->Arg(4096);
+BENCHMARK(codecvt_in<text_kind::latin>)->Arg(64)->Arg(4096);
+BENCHMARK(codecvt_in<text_kind::cjk>)->Arg(64)->Arg(4096);
+
+BENCHMARK(codecvt_out<text_kind::ascii>)->Arg(64)->Arg(4096);
+BENCHMARK(codecvt_out<text_kind::latin>)->Arg(64)->Arg(4096);
+BENCHMARK(codecvt_out<text_kind::cjk>)->Arg(64)->Arg(4096);
+
+BENCHMARK(codecvt_utf8_utf16_in<text_kind::ascii>)->Arg(64)->Arg(4096);
+BENCHMARK(codecvt_utf8_utf16_in<text_kind::latin>)->Arg(64)->Arg(4096);
+BENCHMARK(codecvt_utf8_utf16_in<text_kind::cjk>)->Arg(64)->Arg(4096);
+
+BENCHMARK(path_from_u8string<text_kind::ascii>)->Arg(64)->Arg(4096);
+BENCHMARK(path_from_u8string<text_kind::latin>)->Arg(64)->Arg(4096);
+BENCHMARK(path_from_u8string<text_kind::cjk>)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+//
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+// The ranges are equal, so that the whole of them is compared.
+
+void equal_aligned(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    vector<bool> left  = random_vector<bool>(size);
+    vector<bool> right = left;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        bool r = equal(left.cbegin(), left.cend(), right.cbegin());
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+void equal_misaligned(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    vector<bool> left  = random_vector<bool>(size);
+    vector<bool> right = left;
+    right.insert(right.begin(), 3, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        bool r = equal(left.cbegin(), left.cend(), right.cbegin() + 3);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+void mismatch_misaligned(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    vector<bool> left  = random_vector<bool>(size);
+    vector<bool> right = left;
+    right.insert(right.begin(), 3, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        auto r = mismatch(left.cbegin(), left.cend(), right.cbegin() + 3, right.cend());
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+BENCHMARK(equal_aligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(equal_misaligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(mismatch_misaligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+
+BENCHMARK_MAIN();
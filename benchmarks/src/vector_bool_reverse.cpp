@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+//
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+void reverse_block_aligned(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<bool> v  = random_vector<bool>(size);
+
+    for (auto _ : state) {
+        reverse(v.begin(), v.end());
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void reverse_misaligned(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<bool> v  = random_vector<bool>(size);
+
+    for (auto _ : state) {
+        reverse(v.begin() + 1, v.end());
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void rotate_misaligned(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<bool> v  = random_vector<bool>(size);
+
+    for (auto _ : state) {
+        rotate(v.begin(), v.begin() + static_cast<ptrdiff_t>(size / 3), v.end());
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void swap_ranges_misaligned(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    vector<bool> left  = random_vector<bool>(size);
+    vector<bool> right = random_vector<bool>(size);
+
+    for (auto _ : state) {
+        swap_ranges(left.begin() + 1, left.end(), right.begin());
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+    }
+}
+
+BENCHMARK(reverse_block_aligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(reverse_misaligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(rotate_misaligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(swap_ranges_misaligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+//
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "utility.hpp"
+
+using namespace std;
+
+void transform_not_aligned(benchmark::State& state) {
+    const auto size     = static_cast<size_t>(state.range(0));
+    vector<bool> source = random_vector<bool>(size);
+    vector<bool> dest(size, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source);
+        transform(source.cbegin(), source.cend(), dest.begin(), logical_not<>{});
+        benchmark::DoNotOptimize(dest);
+    }
+}
+
+template <class Op>
+void transform_binary_aligned(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    vector<bool> left  = random_vector<bool>(size);
+    vector<bool> right = random_vector<bool>(size);
+    vector<bool> dest(size, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        transform(left.cbegin(), left.cend(), right.cbegin(), dest.begin(), Op{});
+        benchmark::DoNotOptimize(dest);
+    }
+}
+
+template <class Op>
+void transform_binary_misaligned(benchmark::State& state) {
+    const auto size    = static_cast<size_t>(state.range(0));
+    vector<bool> left  = random_vector<bool>(size);
+    vector<bool> right = random_vector<bool>(size);
+    vector<bool> dest(size, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        transform(left.cbegin() + 1, left.cend(), right.cbegin() + 3, dest.begin() + 5, Op{});
+        benchmark::DoNotOptimize(dest);
+    }
+}
+
+void fill_misaligned(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    vector<bool> dest(size, false);
+
+    bool b = true;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(b);
+        fill(dest.begin() + 1, dest.end() - 1, b);
+        benchmark::DoNotOptimize(dest);
+        b = !b;
+    }
+}
+
+BENCHMARK(transform_not_aligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(transform_binary_aligned<bit_and<>>)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(transform_binary_aligned<bit_or<>>)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(transform_binary_aligned<bit_xor<>>)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(transform_binary_misaligned<bit_and<>>)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(transform_binary_misaligned<bit_xor<>>)->RangeMultiplier(64)->Range(64, 64 << 10);
+BENCHMARK(fill_misaligned)->RangeMultiplier(64)->Range(64, 64 << 10);
+
+BENCHMARK_MAIN();
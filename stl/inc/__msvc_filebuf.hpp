@@ -18,6 +18,15 @@ _STL_DISABLE_CLANG_WARNINGS
 #pragma push_macro("new")
 #undef new
 
+extern "C" {
+// Maps the file of _Stream for reading and positions _Stream at the end of the file. On success, [*_First, *_Last)
+// is the contents of the file and *_Next corresponds to the previous position of _Stream.
+_NODISCARD bool __stdcall __std_filebuf_map(FILE* _Stream, char** _First, char** _Next, char** _Last) noexcept;
+
+// Unmaps the mapping that __std_filebuf_map returned as *_First.
+void __stdcall __std_filebuf_unmap(char* _First) noexcept;
+} // extern "C"
+
 // TRANSITION, ABI: The _Path_ish functions accepting filesystem::path are templates
 // which always use the same types as a workaround for user code deriving from iostreams types and
 // __declspec(dllexport)ing the derived types. Adding member functions to iostreams broke the ABI of such DLLs.
@@ -185,6 +194,8 @@ public:
             bool _Closef_sav                        = _Closef;
             bool _Set_eback_sav                     = _Mysb::eback() == &_Mychar;
             bool _Set_eback_live                    = _Mysb::gptr() == &_Mychar;
+            const bool _Mapped_sav                  = _Is_mapped();
+            const bool _Right_mapped                = _Right._Is_mapped();
 
             _Elem* _Pfirst0 = _Mysb::pbase();
             _Elem* _Pnext0  = _Mysb::pptr();
@@ -195,6 +206,10 @@ public:
 
             // reinitialize *this
             _Init(_Right._Myfile, _Right._Myfile ? _Openfl : _Newfl);
+            if (_Right_mapped) {
+                _Mysb::_Init(); // the get area points into the mapping, not into the C stream
+            }
+
             _Mysb::setp(_Right.pbase(), _Right.pptr(), _Right.epptr());
             if (_Right.eback() != &_Right._Mychar) {
                 _Mysb::setg(_Right.eback(), _Right.gptr(), _Right.egptr());
@@ -211,6 +226,10 @@ public:
 
             // reinitialize _Right
             _Right._Init(_Myfile_sav, _Myfile_sav ? _Openfl : _Newfl);
+            if (_Mapped_sav) {
+                _Right._Mysb::_Init();
+            }
+
             _Right.setp(_Pfirst0, _Pnext0, _Pend);
             if (!_Set_eback_sav) {
                 _Right.setg(_Gfirst0, _Gnext0, _Gend);
@@ -311,6 +330,20 @@ public:
     }
 #endif // _HAS_OLD_IOSTREAMS_MEMBERS
 
+    void _Map_input() noexcept {
+        // switch a file just opened with in | binary to reading a mapping of it, if possible; see stdext::open_mapped
+        if constexpr (_Mappable) {
+            char* _First;
+            char* _Next;
+            char* _Last;
+            if (_Myfile && !_Pcvt && !_Is_mapped() && __std_filebuf_map(_Myfile, &_First, &_Next, &_Last)) {
+                _Mysb::_Init(); // the get area no longer points into the C stream's buffer
+                _Mysb::setg(reinterpret_cast<_Elem*>(_First), reinterpret_cast<_Elem*>(_Next),
+                    reinterpret_cast<_Elem*>(_Last));
+            }
+        }
+    }
+
     basic_filebuf* close() {
         basic_filebuf* _Ans;
         if (_Myfile) { // put any homing sequence and close file
@@ -321,6 +354,10 @@ public:
                 _Ans = nullptr;
             }
 
+            if (_Is_mapped()) {
+                __std_filebuf_unmap(reinterpret_cast<char*>(_Mysb::eback()));
+            }
+
             if (_CSTD fclose(_Myfile) != 0) {
                 _Ans = nullptr;
             }
@@ -413,7 +450,7 @@ protected:
             return _Traits::not_eof(_Meta);
         } else if (!_Myfile || _Traits::eq_int_type(_Traits::eof(), _Meta)) {
             return _Traits::eof(); // no open C stream or EOF, fail
-        } else if (!_Pcvt && _Ungetc(_Traits::to_char_type(_Meta), _Myfile)) {
+        } else if (!_Pcvt && !_Is_mapped() && _Ungetc(_Traits::to_char_type(_Meta), _Myfile)) {
             return _Meta; // no facet and unget succeeded, return
         } else if (_Mysb::gptr() != &_Mychar) { // putback to _Mychar
             _Mychar = _Traits::to_char_type(_Meta);
@@ -548,6 +585,9 @@ protected:
                 return _Mysb::xsputn(_Ptr, _Count);
             }
 
+            // The put area is the C stream's buffer, so this copies without taking the CRT's lock until it fills.
+            // There's no separate write-combining buffer: it would need new members, and would reorder this output
+            // around writes through the FILE*. To combine more per lock, call pubsetbuf(nullptr, _Size) before any I/O.
             const streamsize _Start_count = _Count;
             streamsize _Size              = _Mysb::_Pnavail();
             if (0 < _Count && 0 < _Size) { // copy to write buffer
@@ -581,6 +621,10 @@ protected:
             _Off -= static_cast<off_type>(sizeof(_Elem)); // back up over _Elem bytes
         }
 
+        if (_Is_mapped()) { // O(1) seek within the mapping
+            return pos_type{_Seek_mapped(_Off, _Way)};
+        }
+
         if (!_Myfile || !_Endwrite()
             || ((_Off != 0 || _Way != ios_base::cur) && _CSTD _fseeki64(_Myfile, _Off, _Way) != 0)
             || _CSTD fgetpos(_Myfile, &_Fileposition) != 0) {
@@ -595,6 +639,10 @@ protected:
         // change position to _Pos
         off_type _Off = static_cast<off_type>(_Pos);
 
+        if (_Is_mapped()) {
+            return pos_type{_Seek_mapped(_Off, ios_base::beg)}; // no conversion state to restore
+        }
+
         if (!_Myfile || !_Endwrite() || _CSTD fsetpos(_Myfile, &_Off) != 0) {
             return pos_type{off_type{-1}}; // report failure
         }
@@ -614,7 +662,7 @@ protected:
 
         const size_t _Size = static_cast<size_t>(_Count) * sizeof(_Elem);
 
-        if (!_Myfile || _CSTD setvbuf(_Myfile, reinterpret_cast<char*>(_Buffer), _Mode, _Size) != 0) {
+        if (!_Myfile || _Is_mapped() || _CSTD setvbuf(_Myfile, reinterpret_cast<char*>(_Buffer), _Mode, _Size) != 0) {
             return nullptr; // failed
         }
 
@@ -633,7 +681,12 @@ protected:
 
     void __CLR_OR_THIS_CALL imbue(const locale& _Loc) override {
         // set locale to argument (capture nontrivial codecvt facet)
-        _Initcvt(_STD use_facet<_Cvt>(_Loc));
+        const _Cvt& _Newcvt = _STD use_facet<_Cvt>(_Loc);
+        if (!_Newcvt.always_noconv()) {
+            _Unmap(); // conversions need the C stream
+        }
+
+        _Initcvt(_Newcvt);
     }
 
     void _Init(FILE* _File, _Initfl _Which) noexcept { // initialize to C stream _File after {new, open, close}
@@ -710,6 +763,60 @@ protected:
     }
 
 private:
+#if defined(_M_CEE_PURE) || defined(_CRTBLD) // the __std_filebuf_* functions live in the import library
+    static constexpr bool _Mappable = false;
+#else // ^^^ defined(_M_CEE_PURE) || defined(_CRTBLD) / !defined(_M_CEE_PURE) && !defined(_CRTBLD) vvv
+    static constexpr bool _Mappable = sizeof(_Elem) == 1;
+#endif // ^^^ !defined(_M_CEE_PURE) && !defined(_CRTBLD) ^^^
+
+    _NODISCARD bool _Is_mapped() const noexcept { // test whether the get area is a mapping of the file
+        // Without a codecvt facet, the get area of an open filebuf is the C stream's buffer, unless _Map_input()
+        // pointed it at a mapping. (After a converting facet is replaced it is the streambuf's own, but empty.)
+        if constexpr (_Mappable) {
+            return _Myfile && !_Pcvt && _Streambuf_get_area<_Elem, _Traits>::_Is_own(*this)
+                && (_Mysb::eback() == &_Mychar ? _Set_eback : _Mysb::eback()) != nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    off_type _Seek_mapped(const off_type _Off, const ios_base::seekdir _Way) noexcept {
+        // change position within the mapping of the file, return the new position or -1 on failure
+        _Reset_back(); // revert from _Mychar buffer, discarding any putback
+
+        _Elem* const _First = _Mysb::eback();
+        _Elem* const _Last  = _Mysb::egptr();
+        off_type _Base;
+        if (_Way == ios_base::beg) {
+            _Base = 0;
+        } else if (_Way == ios_base::cur) {
+            _Base = _Mysb::gptr() - _First;
+        } else if (_Way == ios_base::end) {
+            _Base = _Last - _First;
+        } else {
+            return -1;
+        }
+
+        if (_Off < -_Base || (_Last - _First) - _Base < _Off) {
+            return -1; // outside the file
+        }
+
+        _Mysb::setg(_First, _First + (_Base + _Off), _Last);
+        return _Base + _Off;
+    }
+
+    void _Unmap() noexcept { // switch from reading a mapping of the file to reading the C stream at the same position
+        if constexpr (_Mappable) {
+            if (_Is_mapped()) {
+                _Reset_back(); // revert from _Mychar buffer
+                const auto _Pos = static_cast<long long>(_Mysb::gptr() - _Mysb::eback());
+                __std_filebuf_unmap(reinterpret_cast<char*>(_Mysb::eback()));
+                (void) _CSTD _fseeki64(_Myfile, _Pos, SEEK_SET);
+                _Init(_Myfile, _Openfl);
+            }
+        }
+    }
+
     const _Cvt* _Pcvt; // pointer to codecvt facet (may be null)
     _Elem _Mychar; // putback character, when _Ungetc fails
     bool _Wrotesome; // true if homing sequence may be needed
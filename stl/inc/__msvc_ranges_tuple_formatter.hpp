@@ -774,6 +774,12 @@ public:
         _Size_ = 0;
     }
 
+    // Commits _Count elements that were written directly past end(); the caller must have checked _Capacity().
+    void _Commit(const size_t _Count) noexcept {
+        _STL_INTERNAL_CHECK(_Count <= _Capacity_ - _Size_);
+        _Size_ += _Count;
+    }
+
     void _Try_reserve(const size_t _New_capacity) {
         if (_New_capacity > _Capacity_) {
             _Grow(_New_capacity);
@@ -42,6 +42,8 @@ __declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_1(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 __declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_2(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+__declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_4(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 
 const void* __stdcall __std_find_not_ch_1(const void* _First, const void* _Last, uint8_t _Val) noexcept;
 const void* __stdcall __std_find_not_ch_2(const void* _First, const void* _Last, uint16_t _Val) noexcept;
@@ -61,11 +63,15 @@ __declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_1(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 __declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_2(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_4(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 
 __declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_1(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 __declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_2(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_4(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 
 } // extern "C"
 
@@ -96,6 +102,8 @@ size_t _Find_last_of_pos_vectorized(const _Ty1* const _Haystack, const size_t _H
         return ::__std_find_last_of_trivial_pos_1(_Haystack, _Haystack_length, _Needle, _Needle_length);
     } else if constexpr (sizeof(_Ty1) == 2) {
         return ::__std_find_last_of_trivial_pos_2(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else if constexpr (sizeof(_Ty1) == 4) {
+        return ::__std_find_last_of_trivial_pos_4(_Haystack, _Haystack_length, _Needle, _Needle_length);
     } else {
         _STL_INTERNAL_STATIC_ASSERT(false); // unexpected size
     }
@@ -138,6 +146,8 @@ size_t _Find_first_not_of_pos_vectorized(const _Ty1* const _Haystack, const size
         return ::__std_find_first_not_of_trivial_pos_1(_Haystack, _Haystack_length, _Needle, _Needle_length);
     } else if constexpr (sizeof(_Ty1) == 2) {
         return ::__std_find_first_not_of_trivial_pos_2(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else if constexpr (sizeof(_Ty1) == 4) {
+        return ::__std_find_first_not_of_trivial_pos_4(_Haystack, _Haystack_length, _Needle, _Needle_length);
     } else {
         _STL_INTERNAL_STATIC_ASSERT(false); // unexpected size
     }
@@ -151,6 +161,8 @@ size_t _Find_last_not_of_pos_vectorized(const _Ty1* const _Haystack, const size_
         return ::__std_find_last_not_of_trivial_pos_1(_Haystack, _Haystack_length, _Needle, _Needle_length);
     } else if constexpr (sizeof(_Ty1) == 2) {
         return ::__std_find_last_not_of_trivial_pos_2(_Haystack, _Haystack_length, _Needle, _Needle_length);
+    } else if constexpr (sizeof(_Ty1) == 4) {
+        return ::__std_find_last_not_of_trivial_pos_4(_Haystack, _Haystack_length, _Needle, _Needle_length);
     } else {
         _STL_INTERNAL_STATIC_ASSERT(false); // unexpected size
     }
@@ -984,12 +996,10 @@ constexpr size_t _Traits_find_last_of(_In_reads_(_Hay_size) const _Traits_ptr_t<
     if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         using _Elem = typename _Traits::char_type;
 #if _USE_STD_VECTOR_ALGORITHMS
-        if constexpr (sizeof(_Elem) <= 2) {
-            if (!_STD _Is_constant_evaluated()) {
-                const size_t _Remaining_size = _Hay_start + 1;
-                if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) { // same threshold for first/last
-                    return _Find_last_of_pos_vectorized(_Haystack, _Remaining_size, _Needle, _Needle_size);
-                }
+        if (!_STD _Is_constant_evaluated()) {
+            const size_t _Remaining_size = _Hay_start + 1;
+            if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) { // same threshold for first/last
+                return _Find_last_of_pos_vectorized(_Haystack, _Remaining_size, _Needle, _Needle_size);
             }
         }
 #endif // _USE_STD_VECTOR_ALGORITHMS
@@ -1036,16 +1046,14 @@ constexpr size_t _Traits_find_first_not_of(_In_reads_(_Hay_size) const _Traits_p
     if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         using _Elem = typename _Traits::char_type;
 #if _USE_STD_VECTOR_ALGORITHMS
-        if constexpr (sizeof(_Elem) <= 2) {
-            if (!_STD _Is_constant_evaluated()) {
-                const size_t _Remaining_size = _Hay_size - _Start_at;
-                if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) {
-                    size_t _Pos = _Find_first_not_of_pos_vectorized(_Hay_start, _Remaining_size, _Needle, _Needle_size);
-                    if (_Pos != static_cast<size_t>(-1)) {
-                        _Pos += _Start_at;
-                    }
-                    return _Pos;
+        if (!_STD _Is_constant_evaluated()) {
+            const size_t _Remaining_size = _Hay_size - _Start_at;
+            if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) {
+                size_t _Pos = _Find_first_not_of_pos_vectorized(_Hay_start, _Remaining_size, _Needle, _Needle_size);
+                if (_Pos != static_cast<size_t>(-1)) {
+                    _Pos += _Start_at;
                 }
+                return _Pos;
             }
         }
 #endif // _USE_STD_VECTOR_ALGORITHMS
@@ -1118,12 +1126,10 @@ constexpr size_t _Traits_find_last_not_of(_In_reads_(_Hay_size) const _Traits_pt
     if constexpr (_Is_implementation_handled_char_traits<_Traits>) {
         using _Elem = typename _Traits::char_type;
 #if _USE_STD_VECTOR_ALGORITHMS
-        if constexpr (sizeof(_Elem) <= 2) {
-            if (!_STD _Is_constant_evaluated()) {
-                const size_t _Remaining_size = _Hay_start + 1;
-                if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) { // same threshold for first/last
-                    return _Find_last_not_of_pos_vectorized(_Haystack, _Remaining_size, _Needle, _Needle_size);
-                }
+        if (!_STD _Is_constant_evaluated()) {
+            const size_t _Remaining_size = _Hay_start + 1;
+            if (_Remaining_size + _Needle_size >= _Threshold_find_first_of) { // same threshold for first/last
+                return _Find_last_not_of_pos_vectorized(_Haystack, _Remaining_size, _Needle, _Needle_size);
             }
         }
 #endif // _USE_STD_VECTOR_ALGORITHMS
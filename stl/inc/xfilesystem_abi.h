@@ -367,6 +367,19 @@ _NODISCARD __std_win_error __stdcall __std_fs_resize_file(_In_z_ const wchar_t*
 
 _NODISCARD __std_win_error __stdcall __std_fs_space(_In_z_ const wchar_t* _Target, _Out_ uintmax_t* _Available,
     _Out_ uintmax_t* _Total_bytes, _Out_ uintmax_t* _Free_bytes) noexcept;
+
+// Called concurrently by the workers of __std_fs_parallel_walk with a batch of the entries of _Dir, excluding . and ..;
+// returning false stops the walk. _Worker is less than the number of workers, and no two calls with the same
+// _Worker overlap.
+using __std_fs_walk_callback = bool(__stdcall*)(_Inout_opt_ void* _Context, _In_ unsigned int _Worker,
+    _In_reads_(_Dir_size) const wchar_t* _Dir, _In_ size_t _Dir_size,
+    _In_reads_(_Count) const __std_fs_find_data* _Entries, _In_ size_t _Count);
+
+_NODISCARD unsigned int __stdcall __std_fs_parallel_walk_workers() noexcept;
+
+_NODISCARD __std_win_error __stdcall __std_fs_parallel_walk(_In_z_ const wchar_t* _Root,
+    _In_ bool _Follow_directory_symlinks, _In_ bool _Skip_permission_denied, _In_ unsigned int _Workers,
+    _In_ __std_fs_walk_callback _Callback, _Inout_opt_ void* _Context) noexcept;
 } // extern "C"
 
 _STD_BEGIN
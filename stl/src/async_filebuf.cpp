@@ -0,0 +1,238 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// background writer thread for stdext::async_filebuf
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <process.h>
+
+#include <Windows.h>
+
+struct __std_async_writer {
+    struct _Filled_buffer {
+        char* _Data;
+        size_t _Size;
+    };
+
+    FILE* _File                          = nullptr;
+    HANDLE _Thread                       = nullptr;
+    SRWLOCK _Lock                        = SRWLOCK_INIT;
+    CONDITION_VARIABLE _Queue_nonempty   = CONDITION_VARIABLE_INIT; // the writer thread waits on this
+    CONDITION_VARIABLE _Buffer_available = CONDITION_VARIABLE_INIT; // producers and flushes wait on this
+
+    // Each of the _Buffer_count buffers is always in exactly one place: the free stack, the queue, held by the
+    // writer thread (while _Writing), or held by the producer. Hence neither the stack nor the queue can overflow.
+    size_t _Buffer_count   = 0;
+    char** _Free           = nullptr;
+    size_t _Free_count     = 0;
+    _Filled_buffer* _Queue = nullptr;
+    size_t _Queue_first    = 0;
+    size_t _Queue_count    = 0;
+    bool _Writing          = false;
+    bool _Stopping         = false;
+    bool _Released         = false; // the writer thread frees *this when it stops
+    bool _Failed           = false;
+
+    bool _Run() noexcept { // write queued buffers until stopped, return _Released
+        AcquireSRWLockExclusive(&_Lock);
+        for (;;) {
+            while (_Queue_count == 0 && !_Stopping) {
+                SleepConditionVariableSRW(&_Queue_nonempty, &_Lock, INFINITE, 0);
+            }
+
+            if (_Queue_count == 0) { // stopping, and everything has been written
+                break;
+            }
+
+            const _Filled_buffer _Next = _Queue[_Queue_first];
+            _Queue_first               = (_Queue_first + 1) % _Buffer_count;
+            --_Queue_count;
+            _Writing = true;
+            ReleaseSRWLockExclusive(&_Lock);
+
+            const bool _Written = fwrite(_Next._Data, 1, _Next._Size, _File) == _Next._Size;
+
+            AcquireSRWLockExclusive(&_Lock);
+            _Failed |= !_Written;
+            _Free[_Free_count++] = _Next._Data;
+            _Writing             = false;
+            WakeAllConditionVariable(&_Buffer_available);
+        }
+
+        const bool _Was_released = _Released;
+        ReleaseSRWLockExclusive(&_Lock);
+        return _Was_released;
+    }
+};
+
+namespace {
+    void _Free_writer(__std_async_writer* const _Writer, const size_t _Allocated) noexcept {
+        for (size_t _Idx = 0; _Idx < _Allocated; ++_Idx) {
+            delete[] _Writer->_Free[_Idx];
+        }
+
+        delete[] _Writer->_Free;
+        delete[] _Writer->_Queue;
+        delete _Writer;
+    }
+
+    unsigned int __stdcall _Async_writer_thread(void* const _Raw) noexcept {
+        // _beginthreadex keeps this module loaded until the thread exits, so a released writer can outlive its owner
+        const auto _Writer = static_cast<__std_async_writer*>(_Raw);
+        if (_Writer->_Run()) {
+            _Free_writer(_Writer, _Writer->_Free_count);
+        }
+
+        return 0;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] __std_async_writer* __stdcall __std_async_writer_create(
+    FILE* const _File, const size_t _Buffer_size, const size_t _Buffer_count) noexcept {
+    if (_Buffer_size == 0 || _Buffer_count < 2) {
+        return nullptr;
+    }
+
+    const auto _Writer = new (_STD nothrow) __std_async_writer;
+    if (!_Writer) {
+        return nullptr;
+    }
+
+    _Writer->_File         = _File;
+    _Writer->_Buffer_count = _Buffer_count;
+    _Writer->_Free         = new (_STD nothrow) char*[_Buffer_count];
+    _Writer->_Queue        = new (_STD nothrow) __std_async_writer::_Filled_buffer[_Buffer_count];
+    if (!_Writer->_Free || !_Writer->_Queue) {
+        _Free_writer(_Writer, 0);
+        return nullptr;
+    }
+
+    for (; _Writer->_Free_count < _Buffer_count; ++_Writer->_Free_count) {
+        const auto _Buffer = new (_STD nothrow) char[_Buffer_size];
+        if (!_Buffer) {
+            _Free_writer(_Writer, _Writer->_Free_count);
+            return nullptr;
+        }
+
+        _Writer->_Free[_Writer->_Free_count] = _Buffer;
+    }
+
+    _Writer->_Thread =
+        reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, _Async_writer_thread, _Writer, 0, nullptr));
+    if (!_Writer->_Thread) {
+        _Free_writer(_Writer, _Buffer_count);
+        return nullptr;
+    }
+
+    return _Writer;
+}
+
+[[nodiscard]] char* __stdcall __std_async_writer_acquire(__std_async_writer* const _Writer) noexcept {
+    // backpressure: wait until the writer thread has finished with a buffer
+    AcquireSRWLockExclusive(&_Writer->_Lock);
+    while (_Writer->_Free_count == 0) {
+        SleepConditionVariableSRW(&_Writer->_Buffer_available, &_Writer->_Lock, INFINITE, 0);
+    }
+
+    const auto _Buffer = _Writer->_Free[--_Writer->_Free_count];
+    ReleaseSRWLockExclusive(&_Writer->_Lock);
+    return _Buffer;
+}
+
+void __stdcall __std_async_writer_submit(
+    __std_async_writer* const _Writer, char* const _Buffer, const size_t _Size) noexcept {
+    AcquireSRWLockExclusive(&_Writer->_Lock);
+    if (_Size == 0) {
+        _Writer->_Free[_Writer->_Free_count++] = _Buffer;
+        WakeAllConditionVariable(&_Writer->_Buffer_available);
+    } else {
+        const size_t _Last     = (_Writer->_Queue_first + _Writer->_Queue_count) % _Writer->_Buffer_count;
+        _Writer->_Queue[_Last] = {_Buffer, _Size};
+        ++_Writer->_Queue_count;
+        WakeConditionVariable(&_Writer->_Queue_nonempty);
+    }
+
+    ReleaseSRWLockExclusive(&_Writer->_Lock);
+}
+
+[[nodiscard]] bool __stdcall __std_async_writer_flush(__std_async_writer* const _Writer) noexcept {
+    // wait until everything submitted so far has been handed to the file
+    AcquireSRWLockExclusive(&_Writer->_Lock);
+    while (_Writer->_Queue_count != 0 || _Writer->_Writing) {
+        SleepConditionVariableSRW(&_Writer->_Buffer_available, &_Writer->_Lock, INFINITE, 0);
+    }
+
+    const bool _Failed = _Writer->_Failed || fflush(_Writer->_File) != 0;
+    ReleaseSRWLockExclusive(&_Writer->_Lock);
+    return !_Failed;
+}
+
+[[nodiscard]] bool __stdcall __std_async_writer_destroy(__std_async_writer* const _Writer) noexcept {
+    // write everything submitted so far, then stop the writer thread; the caller still owns the FILE
+    AcquireSRWLockExclusive(&_Writer->_Lock);
+    _Writer->_Stopping = true;
+    WakeConditionVariable(&_Writer->_Queue_nonempty);
+    ReleaseSRWLockExclusive(&_Writer->_Lock);
+
+    WaitForSingleObjectEx(_Writer->_Thread, INFINITE, FALSE);
+    CloseHandle(_Writer->_Thread);
+
+    const bool _Failed = _Writer->_Failed;
+    _Free_writer(_Writer, _Writer->_Free_count);
+    return !_Failed;
+}
+
+[[nodiscard]] __std_async_writer_release_result __stdcall __std_async_writer_release(
+    __std_async_writer* const _Writer, char* const _Buffer, const size_t _Size) noexcept {
+    // Like submitting _Buffer and calling __std_async_writer_destroy, but without waiting for the writer thread to
+    // exit, which needs the loader lock (for DLL_THREAD_DETACH) and so deadlocks when called under it. The thread
+    // frees _Writer when it stops.
+    if (WaitForSingleObjectEx(_Writer->_Thread, 0, FALSE) == WAIT_TIMEOUT) { // the writer thread is running
+        __std_async_writer_submit(_Writer, _Buffer, _Size);
+        AcquireSRWLockExclusive(&_Writer->_Lock);
+        while (_Writer->_Queue_count != 0 || _Writer->_Writing) {
+            SleepConditionVariableSRW(&_Writer->_Buffer_available, &_Writer->_Lock, INFINITE, 0);
+        }
+
+        const bool _Failed = _Writer->_Failed;
+        CloseHandle(_Writer->_Thread);
+        _Writer->_Stopping = true;
+        _Writer->_Released = true;
+        WakeConditionVariable(&_Writer->_Queue_nonempty);
+        ReleaseSRWLockExclusive(&_Writer->_Lock);
+        return _Failed ? __std_async_writer_release_result::_Write_failed : __std_async_writer_release_result::_Ok;
+    }
+
+    // The writer thread was terminated, such as by ExitProcess before DLL_PROCESS_DETACH destroyed a static
+    // async_filebuf. Write what it didn't, unless it was terminated holding the lock, or while writing, holding the
+    // FILE's lock until the process ends. *_Writer is leaked, as some of its buffers may be lost with the thread.
+    CloseHandle(_Writer->_Thread);
+    if (!TryAcquireSRWLockExclusive(&_Writer->_Lock)) {
+        return __std_async_writer_release_result::_Writer_terminated;
+    }
+
+    if (_Writer->_Writing) {
+        ReleaseSRWLockExclusive(&_Writer->_Lock);
+        return __std_async_writer_release_result::_Writer_terminated;
+    }
+
+    bool _Failed = _Writer->_Failed;
+    for (; _Writer->_Queue_count != 0; --_Writer->_Queue_count) {
+        const auto _Next      = _Writer->_Queue[_Writer->_Queue_first];
+        _Writer->_Queue_first = (_Writer->_Queue_first + 1) % _Writer->_Buffer_count;
+        _Failed |= fwrite(_Next._Data, 1, _Next._Size, _Writer->_File) != _Next._Size;
+        _Writer->_Free[_Writer->_Free_count++] = _Next._Data;
+    }
+
+    _Failed |= fwrite(_Buffer, 1, _Size, _Writer->_File) != _Size;
+    _Writer->_Free[_Writer->_Free_count++] = _Buffer;
+    ReleaseSRWLockExclusive(&_Writer->_Lock);
+    return _Failed ? __std_async_writer_release_result::_Write_failed : __std_async_writer_release_result::_Ok;
+}
+
+} // extern "C"
@@ -0,0 +1,378 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// work-stealing pool for std::async, see _Pool_async_state
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <new>
+#include <process.h>
+#include <xthreads.h>
+
+#include <Windows.h>
+
+#pragma warning(disable : 4074)
+#pragma init_seg(compiler)
+
+extern "C" IMAGE_DOS_HEADER __ImageBase;
+
+namespace {
+    // This file is linked into each module that calls async, so each module has its own pool. Only an EXE uses it:
+    // _beginthreadex keeps a DLL loaded while the pool's threads run, and they never exit, so async in a DLL keeps
+    // using the Windows thread pool.
+    //
+    // A worker pushes the chores it schedules onto the back of its own bounded deque and pops them from there; idle
+    // workers steal from the front of the others' deques. Chores scheduled from other threads, or that don't fit, go
+    // to a shared injection queue.
+    constexpr size_t _Deque_capacity     = 256; // a power of 2
+    constexpr size_t _Max_workers        = 512; // including spare workers
+    constexpr DWORD _Starvation_interval = 100; // milliseconds without progress before adding a spare worker
+    constexpr int _Pool_not_started      = 0;
+    constexpr int _Pool_running          = 1;
+    constexpr int _Pool_unavailable      = 2;
+
+    struct _Pool_chore {
+        void(__cdecl* _Callback)(void*);
+        void* _Data;
+    };
+
+    struct _Pool_deque {
+        SRWLOCK _Lock = SRWLOCK_INIT;
+        size_t _Front = 0; // thieves take from here
+        size_t _Back  = 0; // the owner pushes and pops here
+        _Pool_chore _Chores[_Deque_capacity];
+    };
+
+    // Everything here has a trivial destructor, so tasks that are still queued when the EXE exits can keep using it.
+    struct _Async_pool {
+        SRWLOCK _Lock                      = SRWLOCK_INIT; // guards the injection queue and startup
+        CONDITION_VARIABLE _Work_available = CONDITION_VARIABLE_INIT; // idle workers wait on this
+        CONDITION_VARIABLE _Backlog        = CONDITION_VARIABLE_INIT; // the monitor waits on this
+        CONDITION_VARIABLE _Idle           = CONDITION_VARIABLE_INIT; // _Pool_exit_block waits on this
+        _Pool_chore* _Injected             = nullptr; // ring buffer
+        size_t _Injected_capacity          = 0;
+        size_t _Injected_first             = 0;
+        size_t _Injected_count             = 0;
+        DWORD _Tls_index                   = TLS_OUT_OF_INDEXES; // a worker's own deque
+        _Pool_deque* _Deques[_Max_workers] = {};
+        size_t _Deque_count                = 0; // written before any worker starts
+        size_t _Concurrency                = 0; // set by __std_async_pool_set_concurrency, or 0 for the default
+
+        _STD atomic<int> _State{_Pool_not_started};
+        _STD atomic<ptrdiff_t> _Pending{0}; // queued chores; briefly negative while a push is being counted
+        _STD atomic<size_t> _Running{0}; // chores that have started and not yet returned
+        _STD atomic<size_t> _Workers{0};
+        _STD atomic<size_t> _Sleeping{0};
+        _STD atomic<bool> _Monitor_waiting{false};
+        _STD atomic<bool> _Exiting{false};
+        _STD atomic<size_t> _Executed{0}; // the monitor's measure of progress
+        _STD atomic<size_t> _Steals{0};
+    };
+
+    _Async_pool _Pool;
+
+    // When the EXE exits, statics are destroyed before ExitProcess() terminates the pool's threads. This is
+    // initialized before, and so destroyed after, the program's own statics; it waits for running chores to return,
+    // so that they don't run after the STL's internal locks are destroyed.
+    struct _Pool_exit_block {
+        _Pool_exit_block()                                   = default;
+        _Pool_exit_block(const _Pool_exit_block&)            = delete;
+        _Pool_exit_block& operator=(const _Pool_exit_block&) = delete;
+        ~_Pool_exit_block() noexcept {
+            AcquireSRWLockExclusive(&_Pool._Lock);
+            _Pool._Exiting.store(true);
+            while (_Pool._Running.load() != 0) {
+                SleepConditionVariableSRW(&_Pool._Idle, &_Pool._Lock, INFINITE, 0);
+            }
+
+            ReleaseSRWLockExclusive(&_Pool._Lock);
+        }
+    };
+
+    _Pool_exit_block _Pool_exit_block_instance;
+
+    [[nodiscard]] bool _Hosted_by_exe() noexcept {
+#if defined(_CRT_APP)
+        return false; // GetModuleHandleExW can't be called from an app context
+#else // ^^^ defined(_CRT_APP) / !defined(_CRT_APP) vvv
+        HMODULE _Exe;
+        return GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, nullptr, &_Exe)
+            && _Exe == reinterpret_cast<HMODULE>(&__ImageBase);
+#endif // ^^^ !defined(_CRT_APP) ^^^
+    }
+
+    void _Run_pool_chore(const _Pool_chore _Chore) noexcept {
+        // _Exiting and _Running are ordered like _Sleeping and _Pending in __std_async_pool_submit
+        _Pool._Running.fetch_add(1);
+        _Chore._Callback(_Chore._Data);
+        _Pool._Executed.fetch_add(1, _STD memory_order_relaxed);
+        if (_Pool._Running.fetch_sub(1) == 1 && _Pool._Exiting.load()) {
+            AcquireSRWLockExclusive(&_Pool._Lock);
+            WakeAllConditionVariable(&_Pool._Idle);
+            ReleaseSRWLockExclusive(&_Pool._Lock);
+        }
+    }
+
+    [[nodiscard]] bool _Push_injected(const _Pool_chore _Chore) noexcept { // requires _Pool._Lock
+        if (_Pool._Injected_count == _Pool._Injected_capacity) {
+            const size_t _New_capacity = _Pool._Injected_capacity == 0 ? 64 : _Pool._Injected_capacity * 2;
+            const auto _New_chores     = new (_STD nothrow) _Pool_chore[_New_capacity];
+            if (!_New_chores) {
+                return false;
+            }
+
+            for (size_t _Idx = 0; _Idx < _Pool._Injected_count; ++_Idx) {
+                _New_chores[_Idx] = _Pool._Injected[(_Pool._Injected_first + _Idx) & (_Pool._Injected_capacity - 1)];
+            }
+
+            delete[] _Pool._Injected;
+            _Pool._Injected          = _New_chores;
+            _Pool._Injected_capacity = _New_capacity;
+            _Pool._Injected_first    = 0;
+        }
+
+        const size_t _Last = (_Pool._Injected_first + _Pool._Injected_count) & (_Pool._Injected_capacity - 1);
+
+        _Pool._Injected[_Last] = _Chore;
+        ++_Pool._Injected_count;
+        return true;
+    }
+
+    [[nodiscard]] bool _Take_chore(_Pool_deque* const _Own, const size_t _Self, _Pool_chore& _Chore) noexcept {
+        bool _Found = false;
+        if (_Own) { // newest first, while it's still in cache
+            AcquireSRWLockExclusive(&_Own->_Lock);
+            if (_Own->_Back != _Own->_Front) {
+                _Chore = _Own->_Chores[--_Own->_Back & (_Deque_capacity - 1)];
+                _Found = true;
+            }
+
+            ReleaseSRWLockExclusive(&_Own->_Lock);
+        }
+
+        if (!_Found) {
+            AcquireSRWLockExclusive(&_Pool._Lock);
+            if (_Pool._Injected_count != 0) {
+                _Chore                = _Pool._Injected[_Pool._Injected_first];
+                _Pool._Injected_first = (_Pool._Injected_first + 1) & (_Pool._Injected_capacity - 1);
+                --_Pool._Injected_count;
+                _Found = true;
+            }
+
+            ReleaseSRWLockExclusive(&_Pool._Lock);
+        }
+
+        for (size_t _Offset = 1; !_Found && _Offset <= _Pool._Deque_count; ++_Offset) {
+            const auto _Victim = _Pool._Deques[(_Self + _Offset) % _Pool._Deque_count];
+            if (_Victim == _Own) {
+                continue;
+            }
+
+            AcquireSRWLockExclusive(&_Victim->_Lock);
+            if (_Victim->_Back != _Victim->_Front) { // oldest first, it's likely the largest piece of work
+                _Chore = _Victim->_Chores[_Victim->_Front++ & (_Deque_capacity - 1)];
+                _Found = true;
+                _Pool._Steals.fetch_add(1, _STD memory_order_relaxed);
+            }
+
+            ReleaseSRWLockExclusive(&_Victim->_Lock);
+        }
+
+        if (_Found) {
+            _Pool._Pending.fetch_sub(1);
+        }
+
+        return _Found;
+    }
+
+    unsigned int __stdcall _Pool_worker(void* const _Arg) noexcept {
+        // workers with an index past the deques are spares, which leave once the backlog is gone
+        const auto _Self = reinterpret_cast<size_t>(_Arg);
+        const auto _Own  = _Self < _Pool._Deque_count ? _Pool._Deques[_Self] : nullptr;
+        (void) TlsSetValue(_Pool._Tls_index, _Own);
+        for (;;) {
+            _Pool_chore _Chore;
+            if (_Take_chore(_Own, _Self, _Chore)) {
+                _Run_pool_chore(_Chore);
+                continue;
+            }
+
+            AcquireSRWLockExclusive(&_Pool._Lock);
+            if (!_Own) {
+                if (_Pool._Pending.load() <= 0) {
+                    ReleaseSRWLockExclusive(&_Pool._Lock);
+                    _Pool._Workers.fetch_sub(1);
+                    return 0;
+                }
+
+                // _Pending counts a chore until its taker has finished taking it, so wait for that, or for another
+                // chore, instead of spinning; the timeout lets the spare leave if neither happens
+                _Pool._Sleeping.fetch_add(1);
+                SleepConditionVariableSRW(&_Pool._Work_available, &_Pool._Lock, _Starvation_interval, 0);
+            } else {
+                _Pool._Sleeping.fetch_add(1);
+                while (_Pool._Pending.load() <= 0) {
+                    SleepConditionVariableSRW(&_Pool._Work_available, &_Pool._Lock, INFINITE, 0);
+                }
+            }
+
+            _Pool._Sleeping.fetch_sub(1);
+            ReleaseSRWLockExclusive(&_Pool._Lock);
+        }
+    }
+
+    [[nodiscard]] bool _Start_pool_thread(unsigned int(__stdcall* const _Main)(void*), void* const _Arg) noexcept {
+        const auto _Handle = _beginthreadex(nullptr, 0, _Main, _Arg, 0, nullptr);
+        if (_Handle == 0) {
+            return false;
+        }
+
+        CloseHandle(reinterpret_cast<HANDLE>(_Handle));
+        return true;
+    }
+
+    unsigned int __stdcall _Pool_monitor(void*) noexcept {
+        // Async tasks may block on each other, so a bounded pool could deadlock with every worker waiting for a
+        // chore that is still queued. While chores are queued and none finishes for a while, add a spare.
+        size_t _Last_executed = _Pool._Executed.load();
+        for (;;) {
+            AcquireSRWLockExclusive(&_Pool._Lock);
+            _Pool._Monitor_waiting.store(true);
+            while (_Pool._Pending.load() <= 0) {
+                SleepConditionVariableSRW(&_Pool._Backlog, &_Pool._Lock, INFINITE, 0);
+            }
+
+            _Pool._Monitor_waiting.store(false);
+            ReleaseSRWLockExclusive(&_Pool._Lock);
+
+            Sleep(_Starvation_interval);
+            const size_t _Executed = _Pool._Executed.load();
+            if (_Executed == _Last_executed && _Pool._Pending.load() > 0 && _Pool._Workers.load() < _Max_workers) {
+                _Pool._Workers.fetch_add(1);
+                if (!_Start_pool_thread(_Pool_worker, reinterpret_cast<void*>(_Max_workers))) {
+                    _Pool._Workers.fetch_sub(1);
+                }
+            }
+
+            _Last_executed = _Executed;
+        }
+    }
+
+    [[nodiscard]] bool _Pool_available() noexcept { // starts the pool on first use
+        const int _State = _Pool._State.load();
+        if (_State != _Pool_not_started) {
+            return _State == _Pool_running;
+        }
+
+        AcquireSRWLockExclusive(&_Pool._Lock);
+        if (_Pool._State.load() == _Pool_not_started) {
+            bool _Started = false;
+            if (_Hosted_by_exe()) {
+                size_t _Count = _Pool._Concurrency;
+                if (_Count == 0) {
+                    _Count = _Thrd_hardware_concurrency();
+                    if (_Count == 0) {
+                        _Count = 1;
+                    } else if (_Count > _Max_workers) {
+                        _Count = _Max_workers;
+                    }
+                }
+
+                _Pool._Tls_index = TlsAlloc();
+                if (_Pool._Tls_index != TLS_OUT_OF_INDEXES) {
+                    for (; _Pool._Deque_count < _Count; ++_Pool._Deque_count) {
+                        const auto _Deque = new (_STD nothrow) _Pool_deque;
+                        if (!_Deque) {
+                            break;
+                        }
+
+                        _Pool._Deques[_Pool._Deque_count] = _Deque;
+                    }
+                }
+
+                // a deque whose worker failed to start stays empty, since only its owner pushes onto it
+                for (size_t _Idx = 0; _Idx < _Pool._Deque_count; ++_Idx) {
+                    if (_Start_pool_thread(_Pool_worker, reinterpret_cast<void*>(_Idx))) {
+                        _Pool._Workers.fetch_add(1);
+                    }
+                }
+
+                _Started = _Pool._Workers.load() != 0 && _Start_pool_thread(_Pool_monitor, nullptr);
+            }
+
+            _Pool._State.store(_Started ? _Pool_running : _Pool_unavailable);
+        }
+
+        ReleaseSRWLockExclusive(&_Pool._Lock);
+        return _Pool._State.load() == _Pool_running;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] bool __stdcall __std_async_pool_submit(
+    void(__cdecl* const _Callback)(void*), void* const _Data) noexcept {
+    if (!_Pool_available()) {
+        return false;
+    }
+
+    const _Pool_chore _Chore{_Callback, _Data};
+    bool _Queued = false;
+    if (const auto _Own = static_cast<_Pool_deque*>(TlsGetValue(_Pool._Tls_index))) {
+        AcquireSRWLockExclusive(&_Own->_Lock);
+        if (_Own->_Back - _Own->_Front < _Deque_capacity) {
+            _Own->_Chores[_Own->_Back++ & (_Deque_capacity - 1)] = _Chore;
+            _Queued                                              = true;
+        }
+
+        ReleaseSRWLockExclusive(&_Own->_Lock);
+    }
+
+    if (!_Queued) {
+        AcquireSRWLockExclusive(&_Pool._Lock);
+        _Queued = _Push_injected(_Chore);
+        ReleaseSRWLockExclusive(&_Pool._Lock);
+        if (!_Queued) {
+            return false;
+        }
+    }
+
+    // Sleepers increment their count and then check _Pending; this increments _Pending and then checks the count,
+    // so at least one side sees the other. Taking the lock orders the wake after the sleep.
+    _Pool._Pending.fetch_add(1);
+    if (_Pool._Sleeping.load() != 0 || _Pool._Monitor_waiting.load()) {
+        AcquireSRWLockExclusive(&_Pool._Lock);
+        WakeConditionVariable(&_Pool._Work_available);
+        WakeConditionVariable(&_Pool._Backlog);
+        ReleaseSRWLockExclusive(&_Pool._Lock);
+    }
+
+    return true;
+}
+
+[[nodiscard]] bool __stdcall __std_async_pool_set_concurrency(const size_t _Workers) noexcept {
+    if (_Workers == 0 || _Workers > _Max_workers) {
+        return false;
+    }
+
+    AcquireSRWLockExclusive(&_Pool._Lock);
+    const bool _Not_started = _Pool._State.load() == _Pool_not_started;
+    if (_Not_started) {
+        _Pool._Concurrency = _Workers;
+    }
+
+    ReleaseSRWLockExclusive(&_Pool._Lock);
+    return _Not_started;
+}
+
+void __stdcall __std_async_pool_get_statistics(
+    size_t* const _Workers, size_t* const _Queued, size_t* const _Executed, size_t* const _Steals) noexcept {
+    const ptrdiff_t _Pending = _Pool._Pending.load(_STD memory_order_relaxed);
+    *_Workers                = _Pool._Workers.load(_STD memory_order_relaxed);
+    *_Queued                 = _Pending > 0 ? static_cast<size_t>(_Pending) : 0;
+    *_Executed               = _Pool._Executed.load(_STD memory_order_relaxed);
+    *_Steals                 = _Pool._Steals.load(_STD memory_order_relaxed);
+}
+
+} // extern "C"
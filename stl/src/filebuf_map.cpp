@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// memory mapped input for basic_filebuf, see stdext::open_mapped
+
+#include <climits>
+#include <cstdio>
+#include <io.h>
+
+#include <Windows.h>
+
+extern "C" {
+
+[[nodiscard]] bool __stdcall __std_filebuf_map(
+    FILE* const _Stream, char** const _First, char** const _Next, char** const _Last) noexcept {
+    const int _Fd = _fileno(_Stream);
+    if (_Fd < 0) {
+        return false;
+    }
+
+    const HANDLE _Handle = reinterpret_cast<HANDLE>(_get_osfhandle(_Fd));
+    if (_Handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // The get area's length is an int, so larger files are read through the C stream.
+    // Empty files can't be mapped, and aren't worth it.
+    LARGE_INTEGER _Size;
+    if (!GetFileSizeEx(_Handle, &_Size) || _Size.QuadPart <= 0 || _Size.QuadPart > INT_MAX) {
+        return false;
+    }
+
+    const long long _Pos = _ftelli64(_Stream);
+    if (_Pos < 0 || _Pos > _Size.QuadPart) {
+        return false;
+    }
+
+    char* _View           = nullptr;
+    const HANDLE _Section = CreateFileMappingW(_Handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_Section) {
+        _View = static_cast<char*>(MapViewOfFile(_Section, FILE_MAP_READ, 0, 0, static_cast<SIZE_T>(_Size.QuadPart)));
+        CloseHandle(_Section); // the view keeps the section alive
+    }
+
+    // leave the C stream at the end of the file, so that reading it after the get area reports end of file
+    if (!_View || _fseeki64(_Stream, _Size.QuadPart, SEEK_SET) != 0) {
+        if (_View) {
+            UnmapViewOfFile(_View);
+        }
+
+        return false;
+    }
+
+    *_First = _View;
+    *_Next  = _View + _Pos;
+    *_Last  = _View + _Size.QuadPart;
+    return true;
+}
+
+void __stdcall __std_filebuf_unmap(char* const _First) noexcept {
+    UnmapViewOfFile(_First);
+}
+
+} // extern "C"
@@ -20,6 +20,12 @@
 
 static_assert(__std_code_page::_Utf8 == __std_code_page{CP_UTF8});
 
+#if defined(_M_IX86) || defined(_M_X64) // NB: includes _M_ARM64EC
+// defined in vector_algorithms.cpp; declared in <xlocale>, which can't be included here
+extern "C" void __stdcall __std_utf8_to_utf16(
+    const void** _First1, const void* _Last1, void** _First2, const void* _Last2) noexcept;
+#endif // ^^^ defined(_M_IX86) || defined(_M_X64) ^^^
+
 namespace {
 
 #ifdef _CRT_APP
@@ -149,6 +155,42 @@ namespace {
     [[nodiscard]] unsigned long long _Merge_to_ull(DWORD _High, DWORD _Low) noexcept {
         return (static_cast<unsigned long long>(_High) << 32) | static_cast<unsigned long long>(_Low);
     }
+
+#if defined(_M_IX86) || defined(_M_X64) // NB: includes _M_ARM64EC
+    // Returns the length of the UTF-16 conversion of well-formed UTF-8 input, like MultiByteToWideChar, converting it
+    // when _Output_len != 0. Returns 0 for anything else (invalid input, or output too small), leaving diagnosis to
+    // MultiByteToWideChar.
+    [[nodiscard]] int _Convert_utf8_to_wide(_In_reads_(_Input_len) const char* const _Input_str, const int _Input_len,
+        _Out_writes_opt_(_Output_len) wchar_t* const _Output_str, const int _Output_len) noexcept {
+        const void* _Src            = _Input_str;
+        const void* const _Src_last = _Input_str + _Input_len;
+        if (_Output_len != 0) {
+            void* _Dest = _Output_str;
+            __std_utf8_to_utf16(&_Src, _Src_last, &_Dest, _Output_str + _Output_len);
+            if (_Src != _Src_last) {
+                return 0;
+            }
+
+            return static_cast<int>(static_cast<wchar_t*>(_Dest) - _Output_str);
+        }
+
+        // only the length is wanted; convert through a scratch buffer, which always has room for a surrogate pair
+        wchar_t _Buffer[256];
+        int _Len = 0;
+        while (_Src != _Src_last) {
+            void* _Dest = _Buffer;
+            __std_utf8_to_utf16(&_Src, _Src_last, &_Dest, _Buffer + 256);
+            const int _Converted = static_cast<int>(static_cast<wchar_t*>(_Dest) - _Buffer);
+            if (_Converted == 0) {
+                return 0;
+            }
+
+            _Len += _Converted;
+        }
+
+        return _Len;
+    }
+#endif // ^^^ defined(_M_IX86) || defined(_M_X64) ^^^
 } // unnamed namespace
 
 extern "C" {
@@ -246,6 +288,16 @@ void __stdcall __std_fs_directory_iterator_close(_In_ const __std_fs_dir_handle
 [[nodiscard]] __std_fs_convert_result __stdcall __std_fs_convert_narrow_to_wide(_In_ const __std_code_page _Code_page,
     _In_reads_(_Input_len) const char* const _Input_str, _In_ const int _Input_len,
     _Out_writes_opt_(_Output_len) wchar_t* const _Output_str, _In_ const int _Output_len) noexcept {
+#if defined(_M_IX86) || defined(_M_X64) // NB: includes _M_ARM64EC
+    if (_Code_page == __std_code_page{CP_UTF8} && _Input_len > 0) {
+        // Well-formed UTF-8 converts the same either way; MultiByteToWideChar reports everything else.
+        const int _Len = _Convert_utf8_to_wide(_Input_str, _Input_len, _Output_str, _Output_len);
+        if (_Len != 0) {
+            return {_Len, __std_win_error::_Success};
+        }
+    }
+#endif // ^^^ defined(_M_IX86) || defined(_M_X64) ^^^
+
     const int _Len = MultiByteToWideChar(
         static_cast<unsigned int>(_Code_page), MB_ERR_INVALID_CHARS, _Input_str, _Input_len, _Output_str, _Output_len);
     return {_Len, _Len == 0 ? __std_win_error{GetLastError()} : __std_win_error::_Success};
@@ -0,0 +1,337 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// parallel directory traversal for stdext::parallel_directory_walk
+
+#include <cstring>
+#include <new>
+#include <xfilesystem_abi.h>
+
+#include <Windows.h>
+
+namespace {
+    // entries are handed to the callback in batches of at most this many, to bound each worker's memory
+    constexpr size_t _Batch_size = 128;
+
+    struct _Pending_dir {
+        _Pending_dir* _Next;
+        bool _Is_root;
+        bool _Is_link; // a followed symlink or junction, which may be broken
+        size_t _Size; // of _Path, excluding the space for the \* suffix and the null terminator
+        wchar_t _Path[1];
+    };
+
+    [[nodiscard]] bool _Needs_separator(const wchar_t* const _Path, const size_t _Size) noexcept {
+        // tests if a name appended to _Path must be preceded by a separator; C: is relative to the drive's current
+        // directory, so it must not get one
+        if (_Size == 0) {
+            return false;
+        }
+
+        const wchar_t _Last = _Path[_Size - 1];
+        return _Last != L'\\' && _Last != L'/' && _Last != L':';
+    }
+
+    [[nodiscard]] _Pending_dir* _Make_pending_dir(const wchar_t* const _Parent, const size_t _Parent_size,
+        const wchar_t* const _Name, const size_t _Name_size, const bool _Is_link) noexcept {
+        // allocates _Parent\_Name, or just _Parent if _Name is empty, with room for a \* suffix and a null terminator
+        const bool _Separator = _Name_size != 0 && _Needs_separator(_Parent, _Parent_size);
+        const size_t _Size    = _Parent_size + _Separator + _Name_size;
+        const auto _Raw       = new (_STD nothrow) unsigned char[sizeof(_Pending_dir) + (_Size + 3) * sizeof(wchar_t)];
+        if (!_Raw) {
+            return nullptr;
+        }
+
+        const auto _Dir = ::new (static_cast<void*>(_Raw)) _Pending_dir;
+        _Dir->_Next     = nullptr;
+        _Dir->_Is_root  = _Name_size == 0;
+        _Dir->_Is_link  = _Is_link;
+        _Dir->_Size     = _Size;
+        _CSTD memcpy(_Dir->_Path, _Parent, _Parent_size * sizeof(wchar_t));
+        if (_Separator) {
+            _Dir->_Path[_Parent_size] = L'\\';
+        }
+
+        if (_Name_size != 0) {
+            _CSTD memcpy(_Dir->_Path + _Parent_size + _Separator, _Name, _Name_size * sizeof(wchar_t));
+        }
+
+        _Dir->_Path[_Size] = L'\0';
+        return _Dir;
+    }
+
+    void _Free_pending_dirs(_Pending_dir* _Dir) noexcept {
+        while (_Dir) {
+            const auto _Next = _Dir->_Next;
+            delete[] reinterpret_cast<unsigned char*>(_Dir);
+            _Dir = _Next;
+        }
+    }
+
+    [[nodiscard]] bool _Is_dot_or_dotdot(const WIN32_FIND_DATAW& _Data) noexcept {
+        const wchar_t* const _Name = _Data.cFileName;
+        return _Name[0] == L'.' && (_Name[1] == L'\0' || (_Name[1] == L'.' && _Name[2] == L'\0'));
+    }
+
+    struct _Walk_state {
+        SRWLOCK _Lock                  = SRWLOCK_INIT;
+        CONDITION_VARIABLE _Work_ready = CONDITION_VARIABLE_INIT; // idle workers wait for directories on this
+
+        // Directories are taken from the top of the stack, which keeps the walk roughly depth first and the number
+        // of pending directories small; each worker pushes all subdirectories of a batch at once.
+        _Pending_dir* _Pending = nullptr;
+        unsigned int _Busy     = 0; // workers enumerating a directory; the walk is over when none are and none pend
+        bool _Stopping         = false;
+        __std_win_error _Error = __std_win_error::_Success;
+
+        volatile long _Next_worker = 0;
+
+        bool _Follow_directory_symlinks;
+        bool _Skip_permission_denied;
+        __std_fs_walk_callback _Callback;
+        void* _Context;
+
+        void _Stop(const __std_win_error _Reason) noexcept {
+            AcquireSRWLockExclusive(&_Lock);
+            if (!_Stopping) {
+                _Stopping = true;
+                _Error    = _Reason;
+            }
+
+            ReleaseSRWLockExclusive(&_Lock);
+            WakeAllConditionVariable(&_Work_ready);
+        }
+
+        void _Push(_Pending_dir* const _First, _Pending_dir* const _Last) noexcept {
+            AcquireSRWLockExclusive(&_Lock);
+            _Last->_Next = _Pending;
+            _Pending     = _First;
+            ReleaseSRWLockExclusive(&_Lock);
+            WakeAllConditionVariable(&_Work_ready);
+        }
+
+        [[nodiscard]] _Pending_dir* _Pop(_Pending_dir* const _Finished) noexcept {
+            // returns the next directory to enumerate, or nullptr when the walk is over
+            AcquireSRWLockExclusive(&_Lock);
+            if (_Finished) {
+                --_Busy;
+            }
+
+            while (!_Stopping && !_Pending && _Busy != 0) {
+                SleepConditionVariableSRW(&_Work_ready, &_Lock, INFINITE, 0);
+            }
+
+            _Pending_dir* _Dir = nullptr;
+            if (!_Stopping && _Pending) {
+                _Dir        = _Pending;
+                _Pending    = _Dir->_Next;
+                _Dir->_Next = nullptr;
+                ++_Busy;
+            }
+
+            ReleaseSRWLockExclusive(&_Lock);
+            if (!_Dir) {
+                WakeAllConditionVariable(&_Work_ready); // the walk is over, so the other idle workers must return too
+            }
+
+            return _Dir;
+        }
+
+        [[nodiscard]] bool _Is_stopping() noexcept {
+            AcquireSRWLockShared(&_Lock);
+            const bool _Result = _Stopping;
+            ReleaseSRWLockShared(&_Lock);
+            return _Result;
+        }
+
+        [[nodiscard]] bool _Should_descend(const WIN32_FIND_DATAW& _Data) const noexcept {
+            if ((_Data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0) {
+                return false;
+            }
+
+            // like recursive_directory_iterator, symlinks and junctions to directories are followed on request only
+            return _Follow_directory_symlinks || (_Data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) == 0;
+        }
+
+        [[nodiscard]] __std_win_error _Enumerate(
+            const unsigned int _Worker, _Pending_dir& _Dir, __std_fs_find_data* const _Batch) noexcept {
+            size_t _Spec_size = _Dir._Size;
+            if (_Needs_separator(_Dir._Path, _Spec_size)) {
+                _Dir._Path[_Spec_size++] = L'\\';
+            }
+
+            _Dir._Path[_Spec_size]     = L'*';
+            _Dir._Path[_Spec_size + 1] = L'\0';
+
+            const auto _Find_data = reinterpret_cast<WIN32_FIND_DATAW*>(_Batch);
+            const HANDLE _Handle  = FindFirstFileExW(
+                _Dir._Path, FindExInfoBasic, _Find_data, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+            _Dir._Path[_Dir._Size] = L'\0';
+            if (_Handle == INVALID_HANDLE_VALUE) {
+                const auto _Error = __std_win_error{GetLastError()};
+                if (_Error == __std_win_error::_Access_denied && _Skip_permission_denied) {
+                    return __std_win_error::_Success;
+                }
+
+                if (_Dir._Is_link && __std_is_file_not_found(_Error)) {
+                    return __std_win_error::_Success; // like recursive_directory_iterator, skip broken links
+                }
+
+                if (_Error == __std_win_error::_File_not_found
+                    && (!_Dir._Is_root || GetFileAttributesW(_Dir._Path) != INVALID_FILE_ATTRIBUTES)) {
+                    return __std_win_error::_Success; // an empty volume, see GH-4291
+                }
+
+                return _Error;
+            }
+
+            __std_win_error _Error = __std_win_error::_Success;
+            size_t _Count          = 0;
+            for (;;) {
+                if (!_Is_dot_or_dotdot(_Find_data[_Count])) {
+                    ++_Count;
+                }
+
+                const bool _More = FindNextFileW(_Handle, &_Find_data[_Count]) != 0;
+                if (!_More) {
+                    _Error = __std_win_error{GetLastError()};
+                    if (_Error == __std_win_error::_No_more_files) {
+                        _Error = __std_win_error::_Success;
+                    }
+                }
+
+                if (_Count != 0 && (!_More || _Count == _Batch_size)) {
+                    // hand out the subdirectories before the callback runs, so that idle workers can start on them
+                    _Pending_dir* _First = nullptr;
+                    _Pending_dir* _Last  = nullptr;
+                    for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+                        if (!_Should_descend(_Find_data[_Idx])) {
+                            continue;
+                        }
+
+                        const auto& _Data   = _Find_data[_Idx];
+                        const bool _Is_link = (_Data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+                        const auto _Sub     = _Make_pending_dir(
+                            _Dir._Path, _Dir._Size, _Data.cFileName, _CSTD wcslen(_Data.cFileName), _Is_link);
+                        if (!_Sub) {
+                            _Free_pending_dirs(_First);
+                            FindClose(_Handle);
+                            return __std_win_error::_Not_enough_memory;
+                        }
+
+                        if (_Last) {
+                            _Last->_Next = _Sub;
+                        } else {
+                            _First = _Sub;
+                        }
+
+                        _Last = _Sub;
+                    }
+
+                    if (_First) {
+                        _Push(_First, _Last);
+                    }
+
+                    if (_Is_stopping()) {
+                        break;
+                    }
+
+                    if (!_Callback(_Context, _Worker, _Dir._Path, _Dir._Size, _Batch, _Count)) {
+                        _Stop(__std_win_error::_Success);
+                        break;
+                    }
+
+                    if (_More) {
+                        _Find_data[0] = _Find_data[_Count];
+                        _Count        = 0;
+                    }
+                }
+
+                if (!_More) {
+                    break;
+                }
+            }
+
+            FindClose(_Handle);
+            return _Error;
+        }
+
+        void _Run() noexcept {
+            const auto _Worker = static_cast<unsigned int>(InterlockedIncrement(&_Next_worker) - 1);
+
+            // one more than a batch, since FindNextFileW writes the entry that follows a full batch
+            const auto _Batch = new (_STD nothrow) __std_fs_find_data[_Batch_size + 1];
+            if (!_Batch) {
+                _Stop(__std_win_error::_Not_enough_memory);
+                return;
+            }
+
+            for (_Pending_dir* _Dir = _Pop(nullptr); _Dir; _Dir = _Pop(_Dir)) {
+                const auto _Error = _Enumerate(_Worker, *_Dir, _Batch);
+                if (_Error != __std_win_error::_Success) {
+                    _Stop(_Error);
+                }
+
+                _Free_pending_dirs(_Dir);
+            }
+
+            delete[] _Batch;
+        }
+    };
+
+    void __stdcall _Walk_worker(PTP_CALLBACK_INSTANCE, void* const _State, PTP_WORK) noexcept {
+        static_cast<_Walk_state*>(_State)->_Run();
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] unsigned int __stdcall __std_fs_parallel_walk_workers() noexcept {
+    SYSTEM_INFO _Info;
+    GetNativeSystemInfo(&_Info);
+    return _Info.dwNumberOfProcessors == 0 ? 1 : static_cast<unsigned int>(_Info.dwNumberOfProcessors);
+}
+
+[[nodiscard]] __std_win_error __stdcall __std_fs_parallel_walk(_In_z_ const wchar_t* const _Root,
+    _In_ const bool _Follow_directory_symlinks, _In_ const bool _Skip_permission_denied,
+    _In_ const unsigned int _Workers, _In_ const __std_fs_walk_callback _Callback,
+    _Inout_opt_ void* const _Context) noexcept {
+    const size_t _Root_size = _CSTD wcslen(_Root);
+    if (_Root_size == 0) {
+        return __std_win_error::_File_not_found;
+    }
+
+    _Walk_state _State;
+    _State._Follow_directory_symlinks = _Follow_directory_symlinks;
+    _State._Skip_permission_denied    = _Skip_permission_denied;
+    _State._Callback                  = _Callback;
+    _State._Context                   = _Context;
+    _State._Pending                   = _Make_pending_dir(_Root, _Root_size, nullptr, 0, false);
+    if (!_State._Pending) {
+        return __std_win_error::_Not_enough_memory;
+    }
+
+    // The calling thread is worker 0. The other workers run on the thread pool; if it can't provide them, the
+    // calling thread walks the whole tree.
+    PTP_WORK _Work = nullptr;
+    if (_Workers > 1) {
+        _Work = CreateThreadpoolWork(_Walk_worker, &_State, nullptr);
+        if (_Work) {
+            for (unsigned int _Idx = 1; _Idx < _Workers; ++_Idx) {
+                SubmitThreadpoolWork(_Work);
+            }
+        }
+    }
+
+    _State._Run();
+
+    if (_Work) {
+        WaitForThreadpoolWorkCallbacks(_Work, FALSE);
+        CloseThreadpoolWork(_Work);
+    }
+
+    _Free_pending_dirs(_State._Pending); // left over if the walk stopped early
+    return _State._Error;
+}
+
+} // extern "C"
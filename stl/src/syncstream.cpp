@@ -4,6 +4,8 @@
 // initialize syncstream mutex map
 
 #include <__msvc_tzdb.hpp>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <mutex>
@@ -20,14 +22,27 @@ static std::_Init_locks initlocks;
 namespace {
     struct _Mutex_count_pair {
         _STD shared_mutex _Mutex;
-        size_t _Ref_count = 0;
+        _STD atomic<size_t> _Ref_count{0};
     };
 
     using _Map_alloc = _STD _Crt_allocator<_STD pair<void* const, _Mutex_count_pair>>;
     using _Map_type  = _STD map<void*, _Mutex_count_pair, _STD less<void*>, _Map_alloc>;
 
-    _Map_type _Lookup_map;
-    _STD shared_mutex _Lookup_mutex;
+    // The map is split into shards so that syncbufs wrapping different streambufs don't contend on one lock. Within a
+    // shard, instances that already have a mutex are found under a shared lock and only their count changes.
+    struct _Lookup_shard {
+        _STD shared_mutex _Lookup_mutex;
+        _Map_type _Lookup_map; // guarded by _Lookup_mutex; counts may change under a shared lock
+    };
+
+    constexpr size_t _Shard_count = 64;
+    _Lookup_shard _Lookup_shards[_Shard_count];
+
+    [[nodiscard]] _Lookup_shard& _Shard_for(void* const _Ptr) noexcept {
+        // streambufs are larger than 16 bytes, so the low bits carry no information
+        const auto _Value = reinterpret_cast<uintptr_t>(_Ptr);
+        return _Lookup_shards[static_cast<size_t>((_Value >> 4) ^ (_Value >> 10)) % _Shard_count];
+    }
 } // unnamed namespace
 
 extern "C" {
@@ -35,10 +50,21 @@ extern "C" {
 // TRANSITION, ABI: This returns a pointer to a C++ type.
 // A flat C interface would return an opaque handle and would provide separate functions for locking and unlocking.
 [[nodiscard]] _STD shared_mutex* __stdcall __std_acquire_shared_mutex_for_instance(void* _Ptr) noexcept {
+    auto& _Shard = _Shard_for(_Ptr);
+    {
+        _STD shared_lock _Guard(_Shard._Lookup_mutex);
+        const auto _Instance_mutex_iter = _Shard._Lookup_map.find(_Ptr);
+        if (_Instance_mutex_iter != _Shard._Lookup_map.end()) {
+            // erasing needs the exclusive lock, so the entry outlives this increment
+            _Instance_mutex_iter->second._Ref_count.fetch_add(1, _STD memory_order_relaxed);
+            return &_Instance_mutex_iter->second._Mutex;
+        }
+    }
+
     try {
-        _STD scoped_lock _Guard(_Lookup_mutex);
-        auto& [_Mutex, _Refs] = _Lookup_map.try_emplace(_Ptr).first->second;
-        ++_Refs;
+        _STD scoped_lock _Guard(_Shard._Lookup_mutex);
+        auto& [_Mutex, _Refs] = _Shard._Lookup_map.try_emplace(_Ptr).first->second;
+        _Refs.fetch_add(1, _STD memory_order_relaxed);
         return &_Mutex;
     } catch (...) {
         return nullptr;
@@ -46,12 +72,23 @@ extern "C" {
 }
 
 void __stdcall __std_release_shared_mutex_for_instance(void* _Ptr) noexcept {
-    _STD scoped_lock _Guard(_Lookup_mutex);
-    const auto _Instance_mutex_iter = _Lookup_map.find(_Ptr);
-    _ASSERT_EXPR(_Instance_mutex_iter != _Lookup_map.end(), "No mutex exists for given instance!");
-    auto& _Refs = _Instance_mutex_iter->second._Ref_count;
-    if (--_Refs == 0) {
-        _Lookup_map.erase(_Instance_mutex_iter);
+    auto& _Shard = _Shard_for(_Ptr);
+    {
+        _STD shared_lock _Guard(_Shard._Lookup_mutex);
+        const auto _Instance_mutex_iter = _Shard._Lookup_map.find(_Ptr);
+        _ASSERT_EXPR(_Instance_mutex_iter != _Shard._Lookup_map.end(), "No mutex exists for given instance!");
+        if (_Instance_mutex_iter->second._Ref_count.fetch_sub(1, _STD memory_order_acq_rel) != 1) {
+            return;
+        }
+    }
+
+    // This was the last reference, unless another syncbuf acquired the mutex before the exclusive lock was taken.
+    // If that syncbuf has also released it already, whichever of us gets here first erases the entry.
+    _STD scoped_lock _Guard(_Shard._Lookup_mutex);
+    const auto _Instance_mutex_iter = _Shard._Lookup_map.find(_Ptr);
+    if (_Instance_mutex_iter != _Shard._Lookup_map.end()
+        && _Instance_mutex_iter->second._Ref_count.load(_STD memory_order_relaxed) == 0) {
+        _Shard._Lookup_map.erase(_Instance_mutex_iter);
     }
 }
 
@@ -4534,7 +4534,7 @@ namespace {
                 return _Eq;
             }
 
-            template <class _Ty, bool _Large, size_t _Last2_length_el_magnitude>
+            template <class _Ty, _Predicate _Pred, bool _Large, size_t _Last2_length_el_magnitude>
             const void* _Shuffle_impl(const void* _First1, const size_t _Haystack_length, const void* const _First2,
                 const void* const _Stop2, const size_t _Last2_length_el) noexcept {
                 using _Traits               = _Find_first_of_traits<_Ty>;
@@ -4559,7 +4559,12 @@ namespace {
                         }
                     }
 
-                    if (const uint32_t _Bingo = _mm256_movemask_epi8(_Eq); _Bingo != 0) {
+                    uint32_t _Bingo = _mm256_movemask_epi8(_Eq);
+                    if constexpr (_Pred == _Predicate::_None_of) {
+                        _Bingo ^= 0xFFFF'FFFF;
+                    }
+
+                    if (_Bingo != 0) {
                         const unsigned long _Offset = _tzcnt_u32(_Bingo);
                         _Advance_bytes(_First1, _Offset);
                         return _First1;
@@ -4578,7 +4583,14 @@ namespace {
                         }
                     }
 
-                    if (const uint32_t _Bingo = _mm256_movemask_epi8(_mm256_and_si256(_Eq, _Tail_mask)); _Bingo != 0) {
+                    __m256i _Found;
+                    if constexpr (_Pred == _Predicate::_Any_of) {
+                        _Found = _mm256_and_si256(_Eq, _Tail_mask);
+                    } else {
+                        _Found = _mm256_andnot_si256(_Eq, _Tail_mask);
+                    }
+
+                    if (const uint32_t _Bingo = _mm256_movemask_epi8(_Found); _Bingo != 0) {
                         const unsigned long _Offset = _tzcnt_u32(_Bingo);
                         _Advance_bytes(_First1, _Offset);
                         return _First1;
@@ -4590,20 +4602,24 @@ namespace {
                 return _First1;
             }
 
-            template <class _Ty, bool _Large>
+            template <class _Ty, _Predicate _Pred, bool _Large>
             const void* _Shuffle_impl_dispatch_magnitude(const void* const _First1, const size_t _Haystack_length,
                 const void* const _First2, const void* const _Stop2, const size_t _Last2_length_el) noexcept {
                 if (_Last2_length_el == 0) {
-                    return _Shuffle_impl<_Ty, _Large, 0>(_First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 0>(
+                        _First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
                 } else if (_Last2_length_el == 1) {
-                    return _Shuffle_impl<_Ty, _Large, 1>(_First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 1>(
+                        _First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
                 } else if (_Last2_length_el == 2) {
-                    return _Shuffle_impl<_Ty, _Large, 2>(_First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 2>(
+                        _First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
                 } else if (_Last2_length_el <= 4) {
-                    return _Shuffle_impl<_Ty, _Large, 4>(_First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 4>(
+                        _First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
                 } else if (_Last2_length_el <= 8) {
                     if constexpr (sizeof(_Ty) == 4) {
-                        return _Shuffle_impl<_Ty, _Large, 8>(
+                        return _Shuffle_impl<_Ty, _Pred, _Large, 8>(
                             _First1, _Haystack_length, _First2, _Stop2, _Last2_length_el);
                     }
                 }
@@ -4611,7 +4627,7 @@ namespace {
                 _STL_UNREACHABLE;
             }
 
-            template <class _Ty>
+            template <class _Ty, _Predicate _Pred>
             const void* _Impl_4_8(const void* const _First1, const size_t _Haystack_length, const void* const _First2,
                 const size_t _Needle_length) noexcept {
                 _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
@@ -4622,10 +4638,10 @@ namespace {
                 if (const size_t _Needle_length_large = _Needle_length & ~size_t{0x1F}; _Needle_length_large != 0) {
                     const void* _Stop2 = _First2;
                     _Advance_bytes(_Stop2, _Needle_length_large);
-                    return _Shuffle_impl_dispatch_magnitude<_Ty, true>(
+                    return _Shuffle_impl_dispatch_magnitude<_Ty, _Pred, true>(
                         _First1, _Haystack_length, _First2, _Stop2, _Last_needle_length_el);
                 } else {
-                    return _Shuffle_impl_dispatch_magnitude<_Ty, false>(
+                    return _Shuffle_impl_dispatch_magnitude<_Ty, _Pred, false>(
                         _First1, _Haystack_length, _First2, _First2, _Last_needle_length_el);
                 }
             }
@@ -4642,7 +4658,7 @@ namespace {
                     }
                 } else {
                     if (_Use_avx2()) {
-                        return _Impl_4_8<_Ty>(
+                        return _Impl_4_8<_Ty, _Predicate::_Any_of>(
                             _First1, _Byte_length(_First1, _Last1), _First2, _Byte_length(_First2, _Last2));
                     }
                 }
@@ -4689,7 +4705,7 @@ namespace {
                     _Impl_pcmpestri<_Ty, _Pred>(_First1, _Size_bytes_1, _First2, _Size_bytes_2), _First1, _Last1);
             }
 
-            template <class _Ty>
+            template <class _Ty, _Predicate _Pred>
             size_t _Dispatch_pos_avx_4_8(const void* const _First1, const size_t _Count1, const void* const _First2,
                 const size_t _Count2) noexcept {
                 using namespace _Bitmap_impl;
@@ -4698,13 +4714,13 @@ namespace {
 
                 if (_Strat == _Strategy::_Vector_bitmap) {
                     if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
-                        return _Impl_first_avx<_Ty, _Predicate::_Any_of>(_First1, _Count1, _First2, _Count2);
+                        return _Impl_first_avx<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
                     }
                 } else if (_Strat == _Strategy::_Scalar_bitmap) {
                     if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
                         alignas(32) _Scalar_table_t _Table = {};
                         _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
-                        return _Impl_first_scalar<_Ty, _Predicate::_Any_of>(_First1, _Count1, _Table);
+                        return _Impl_first_scalar<_Ty, _Pred>(_First1, _Count1, _Table);
                     }
                 }
 
@@ -4713,7 +4729,7 @@ namespace {
                 const size_t _Size_bytes_2 = _Count2 * sizeof(_Ty);
 
                 return _Pos_from_ptr<_Ty>(
-                    _Impl_4_8<_Ty>(_First1, _Size_bytes_1, _First2, _Size_bytes_2), _First1, _Last1);
+                    _Impl_4_8<_Ty, _Pred>(_First1, _Size_bytes_1, _First2, _Size_bytes_2), _First1, _Last1);
             }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
 
@@ -4743,9 +4759,7 @@ namespace {
                     }
                 } else {
                     if (_Use_avx2()) {
-                        static_assert(_Pred == _Predicate::_Any_of);
-
-                        return _Dispatch_pos_avx_4_8<_Ty>(_First1, _Count1, _First2, _Count2);
+                        return _Dispatch_pos_avx_4_8<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
                     }
                 }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
@@ -4956,6 +4970,141 @@ namespace {
                     return static_cast<size_t>(_Not_found);
                 }
             }
+
+            template <class _Ty, _Predicate _Pred, bool _Large, size_t _Last2_length_el_magnitude>
+            size_t _Shuffle_impl(const void* const _Haystack, const size_t _Haystack_length, const void* const _First2,
+                const void* const _Stop2, const size_t _Last2_length_el) noexcept {
+                // mirrors _First_of::_Shuffle_impl, going from the end
+                using _First_of::_Shuffle_step;
+
+                using _Traits               = _First_of::_Find_first_of_traits<_Ty>;
+                constexpr size_t _Length_el = 32 / sizeof(_Ty);
+
+                const __m256i _Last2val = _mm256_maskload_epi32(
+                    reinterpret_cast<const int*>(_Stop2), _Avx2_tail_mask_32(_Last2_length_el * sizeof(_Ty)));
+                const __m256i _Last2s0 =
+                    _Traits::template _Spread_avx<_Last2_length_el_magnitude>(_Last2val, _Last2_length_el);
+
+                const void* _Cur = _Haystack;
+                _Advance_bytes(_Cur, _Haystack_length);
+
+                const void* _Stop1 = _Haystack;
+                _Advance_bytes(_Stop1, _Haystack_length & 0x1F);
+
+                while (_Cur != _Stop1) {
+                    _Rewind_bytes(_Cur, 32);
+                    const __m256i _Data1 = _mm256_loadu_si256(static_cast<const __m256i*>(_Cur));
+                    __m256i _Eq          = _Shuffle_step<_Traits, _Last2_length_el_magnitude>(_Data1, _Last2s0);
+
+                    if constexpr (_Large) {
+                        for (const void* _Ptr2 = _First2; _Ptr2 != _Stop2; _Advance_bytes(_Ptr2, 32)) {
+                            const __m256i _Data2s0 = _mm256_loadu_si256(static_cast<const __m256i*>(_Ptr2));
+                            _Eq = _mm256_or_si256(_Eq, _Shuffle_step<_Traits, _Length_el>(_Data1, _Data2s0));
+                        }
+                    }
+
+                    uint32_t _Bingo = _mm256_movemask_epi8(_Eq);
+                    if constexpr (_Pred == _Predicate::_None_of) {
+                        _Bingo ^= 0xFFFF'FFFF;
+                    }
+
+                    if (_Bingo != 0) {
+                        return (_Byte_length(_Haystack, _Cur) + 31 - _lzcnt_u32(_Bingo)) / sizeof(_Ty);
+                    }
+                }
+
+                if (const size_t _Haystack_head_length = _Haystack_length & 0x1C; _Haystack_head_length != 0) {
+                    const __m256i _Head_mask = _Avx2_tail_mask_32(_Haystack_head_length);
+                    const __m256i _Data1     = _mm256_maskload_epi32(static_cast<const int*>(_Haystack), _Head_mask);
+                    __m256i _Eq              = _Shuffle_step<_Traits, _Last2_length_el_magnitude>(_Data1, _Last2s0);
+
+                    if constexpr (_Large) {
+                        for (const void* _Ptr2 = _First2; _Ptr2 != _Stop2; _Advance_bytes(_Ptr2, 32)) {
+                            const __m256i _Data2s0 = _mm256_loadu_si256(static_cast<const __m256i*>(_Ptr2));
+                            _Eq = _mm256_or_si256(_Eq, _Shuffle_step<_Traits, _Length_el>(_Data1, _Data2s0));
+                        }
+                    }
+
+                    __m256i _Found;
+                    if constexpr (_Pred == _Predicate::_Any_of) {
+                        _Found = _mm256_and_si256(_Eq, _Head_mask);
+                    } else {
+                        _Found = _mm256_andnot_si256(_Eq, _Head_mask);
+                    }
+
+                    if (const uint32_t _Bingo = _mm256_movemask_epi8(_Found); _Bingo != 0) {
+                        return (31 - _lzcnt_u32(_Bingo)) / sizeof(_Ty);
+                    }
+                }
+
+                return static_cast<size_t>(-1);
+            }
+
+            template <class _Ty, _Predicate _Pred, bool _Large>
+            size_t _Shuffle_impl_dispatch_magnitude(const void* const _Haystack, const size_t _Haystack_length,
+                const void* const _First2, const void* const _Stop2, const size_t _Last2_length_el) noexcept {
+                if (_Last2_length_el == 0) {
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 0>(
+                        _Haystack, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                } else if (_Last2_length_el == 1) {
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 1>(
+                        _Haystack, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                } else if (_Last2_length_el == 2) {
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 2>(
+                        _Haystack, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                } else if (_Last2_length_el <= 4) {
+                    return _Shuffle_impl<_Ty, _Pred, _Large, 4>(
+                        _Haystack, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                } else if (_Last2_length_el <= 8) {
+                    if constexpr (sizeof(_Ty) == 4) {
+                        return _Shuffle_impl<_Ty, _Pred, _Large, 8>(
+                            _Haystack, _Haystack_length, _First2, _Stop2, _Last2_length_el);
+                    }
+                }
+
+                _STL_UNREACHABLE;
+            }
+
+            template <class _Ty, _Predicate _Pred>
+            size_t _Impl_4_8(const void* const _Haystack, const size_t _Haystack_length, const void* const _First2,
+                const size_t _Needle_length) noexcept {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                const size_t _Last_needle_length    = _Needle_length & 0x1F;
+                const size_t _Last_needle_length_el = _Last_needle_length / sizeof(_Ty);
+
+                if (const size_t _Needle_length_large = _Needle_length & ~size_t{0x1F}; _Needle_length_large != 0) {
+                    const void* _Stop2 = _First2;
+                    _Advance_bytes(_Stop2, _Needle_length_large);
+                    return _Shuffle_impl_dispatch_magnitude<_Ty, _Pred, true>(
+                        _Haystack, _Haystack_length, _First2, _Stop2, _Last_needle_length_el);
+                } else {
+                    return _Shuffle_impl_dispatch_magnitude<_Ty, _Pred, false>(
+                        _Haystack, _Haystack_length, _First2, _First2, _Last_needle_length_el);
+                }
+            }
+
+            template <class _Ty, _Predicate _Pred>
+            size_t _Dispatch_pos_avx_4_8(const void* const _First1, const size_t _Count1, const void* const _First2,
+                const size_t _Count2) noexcept {
+                using namespace _Bitmap_impl;
+
+                const auto _Strat = _Pick_strategy<_Ty>(_Count1, _Count2, true);
+
+                if (_Strat == _Strategy::_Vector_bitmap) {
+                    if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
+                        return _Impl_last_avx<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
+                    }
+                } else if (_Strat == _Strategy::_Scalar_bitmap) {
+                    if (_Can_fit_256_bits_sse(static_cast<const _Ty*>(_First2), _Count2)) {
+                        alignas(32) _Scalar_table_t _Table = {};
+                        _Build_scalar_table_no_check<_Ty>(_First2, _Count2, _Table);
+                        return _Impl_last_scalar<_Ty, _Pred>(_First1, _Count1, _Table);
+                    }
+                }
+
+                return _Impl_4_8<_Ty, _Pred>(_First1, _Count1 * sizeof(_Ty), _First2, _Count2 * sizeof(_Ty));
+            }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
 
             template <class _Ty, _Predicate _Pred>
@@ -4964,7 +5113,11 @@ namespace {
                 using namespace _Bitmap_impl;
 
 #ifndef _M_ARM64EC
-                if (_Use_sse42()) {
+                if constexpr (sizeof(_Ty) > 2) {
+                    if (_Use_avx2()) {
+                        return _Dispatch_pos_avx_4_8<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
+                    }
+                } else if (_Use_sse42()) {
                     const auto _Strat = _Pick_strategy<_Ty>(_Count1, _Count2, _Use_avx2());
 
                     if (_Strat == _Strategy::_Vector_bitmap) {
@@ -4980,16 +5133,15 @@ namespace {
                     }
 
                     return _Impl<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
-                } else
+                }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
-                {
-                    alignas(32) _Scalar_table_t _Table = {};
-                    if (_Build_scalar_table<_Ty>(_First2, _Count2, _Table)) {
-                        return _Impl_last_scalar<_Ty, _Pred>(_First1, _Count1, _Table);
-                    }
 
-                    return _Fallback<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
+                alignas(32) _Scalar_table_t _Table = {};
+                if (_Build_scalar_table<_Ty>(_First2, _Count2, _Table)) {
+                    return _Impl_last_scalar<_Ty, _Pred>(_First1, _Count1, _Table);
                 }
+
+                return _Fallback<_Ty, _Pred>(_First1, _Count1, _First2, _Count2);
             }
         } // namespace _Last_of
     } // namespace _Find_meow_of
@@ -5053,6 +5205,12 @@ __declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_2(const void
         _Haystack, _Haystack_length, _Needle, _Needle_length);
 }
 
+__declspec(noalias) size_t __stdcall __std_find_last_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_meow_of::_Last_of::_Dispatch_pos<uint32_t, _Find_meow_of::_Predicate::_Any_of>(
+        _Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
 __declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_1(const void* const _Haystack,
     const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
     return _Find_meow_of::_First_of::_Dispatch_pos<uint8_t, _Find_meow_of::_Predicate::_None_of>(
@@ -5065,6 +5223,12 @@ __declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_2(const
         _Haystack, _Haystack_length, _Needle, _Needle_length);
 }
 
+__declspec(noalias) size_t __stdcall __std_find_first_not_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_meow_of::_First_of::_Dispatch_pos<uint32_t, _Find_meow_of::_Predicate::_None_of>(
+        _Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
 __declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_1(const void* const _Haystack,
     const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
     return _Find_meow_of::_Last_of::_Dispatch_pos<uint8_t, _Find_meow_of::_Predicate::_None_of>(
@@ -5077,6 +5241,12 @@ __declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_2(const
         _Haystack, _Haystack_length, _Needle, _Needle_length);
 }
 
+__declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_4(const void* const _Haystack,
+    const size_t _Haystack_length, const void* const _Needle, const size_t _Needle_length) noexcept {
+    return _Find_meow_of::_Last_of::_Dispatch_pos<uint32_t, _Find_meow_of::_Predicate::_None_of>(
+        _Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
 } // extern "C"
 
 namespace {
@@ -6206,884 +6376,2168 @@ __declspec(noalias) void __stdcall __std_replace_8(
 } // extern "C"
 
 namespace {
-    namespace _Removing {
-        template <class _Ty>
-        void* _Remove_fallback(
-            const void* const _First, const void* const _Last, void* const _Out, const _Ty _Val) noexcept {
-            const _Ty* _Src = reinterpret_cast<const _Ty*>(_First);
-            _Ty* _Dest      = reinterpret_cast<_Ty*>(_Out);
+    namespace _Ascii_case {
+        // The classic "C" locale changes the case of the 26 ASCII letters only. Changing it toggles bit 0x20, and
+        // doing it again is a no-op, because the letters of the other case are never in range.
 
-            while (_Src != _Last) {
-                if (*_Src != _Val) {
-                    *_Dest = *_Src;
-                    ++_Dest;
-                }
+        unsigned char _Fold_scalar(const unsigned char _Ch, const unsigned char _First_letter) noexcept {
+            return static_cast<unsigned char>(_Ch - _First_letter) < 26 ? static_cast<unsigned char>(_Ch ^ 0x20) : _Ch;
+        }
 
-                ++_Src;
+        size_t _Mismatch_scalar(const unsigned char* const _First1, const unsigned char* const _First2,
+            size_t _Pos, const size_t _Count, const bool _Fold_right) noexcept {
+            for (; _Pos != _Count; ++_Pos) {
+                const unsigned char _Right = _Fold_right ? _Fold_scalar(_First2[_Pos], 'A') : _First2[_Pos];
+                if (_Fold_scalar(_First1[_Pos], 'A') != _Right) {
+                    break;
+                }
             }
 
-            return _Dest;
+            return _Pos;
         }
 
-        template <class _Ty>
-        void* _Unique_fallback(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
-            _Ty* _Out       = reinterpret_cast<_Ty*>(_Dest);
-            const _Ty* _Src = reinterpret_cast<const _Ty*>(_First);
-
-            while (_Src != _Last) {
-                if (*_Src != *_Out) {
-                    ++_Out;
-                    *_Out = *_Src;
+        const unsigned char* _Search_scalar(const unsigned char* _First1, const unsigned char* const _Last1,
+            const unsigned char* const _First2, const size_t _Count2) noexcept {
+            // _Count2 != 0 and _Last1 - _First1 >= _Count2
+            for (const auto _Stop = _Last1 - _Count2; _First1 <= _Stop; ++_First1) {
+                if (_Mismatch_scalar(_First1, _First2, 0, _Count2, false) == _Count2) {
+                    return _First1;
                 }
-
-                ++_Src;
             }
 
-            ++_Out;
-            return _Out;
+            return _Last1;
         }
 
 #ifndef _M_ARM64EC
-        template <size_t _Size_v, size_t _Size_h>
-        struct _Tables {
-            uint8_t _Shuf[_Size_v][_Size_h];
-            uint8_t _Size[_Size_v];
-        };
-
-        template <size_t _Size_v, size_t _Size_h>
-        constexpr auto _Make_tables(const uint32_t _Mul, const uint32_t _Ew) {
-            _Tables<_Size_v, _Size_h> _Result;
-
-            for (uint32_t _Vx = 0; _Vx != _Size_v; ++_Vx) {
-                uint32_t _Nx = 0;
-
-                // Make shuffle mask for pshufb / vpermd corresponding to _Vx bit value.
-                // Every bit set corresponds to an element skipped.
-                for (uint32_t _Hx = 0; _Hx != _Size_h / _Ew; ++_Hx) {
-                    if ((_Vx & (1 << _Hx)) == 0) {
-                        // Inner loop needed for cases where the shuffle mask operates on element parts rather than
-                        // whole elements; for whole elements there would be one iteration.
-                        for (uint32_t _Ex = 0; _Ex != _Ew; ++_Ex) {
-                            _Result._Shuf[_Vx][_Nx * _Ew + _Ex] = static_cast<uint8_t>(_Hx * _Ew + _Ex);
-                        }
-                        ++_Nx;
-                    }
-                }
+        struct _Traits_avx {
+            using _Guard = _Zeroupper_on_exit;
 
-                // Size of elements that are not removed in bytes.
-                _Result._Size[_Vx] = static_cast<uint8_t>(_Nx * _Mul);
+            static constexpr size_t _Vec_size         = 32;
+            static constexpr unsigned int _Full_mask = 0xFFFF'FFFF;
 
-                // Fill the remaining with arbitrary elements.
-                // It is not possible to leave them untouched while keeping this optimization efficient.
-                // This should not be a problem though, as they should be either overwritten by the next step,
-                // or left in the removed range.
-                for (; _Nx != _Size_h / _Ew; ++_Nx) {
-                    // Inner loop needed for cases where the shuffle mask operates on element parts rather than whole
-                    // elements; for whole elements there would be one iteration.
-                    for (uint32_t _Ex = 0; _Ex != _Ew; ++_Ex) {
-                        _Result._Shuf[_Vx][_Nx * _Ew + _Ex] = static_cast<uint8_t>(_Nx * _Ew + _Ex);
-                    }
-                }
+            static __m256i _Set(const char _Val) noexcept {
+                return _mm256_set1_epi8(_Val);
             }
 
-            return _Result;
-        }
-
-        constexpr auto _Tables_1_sse = _Make_tables<256, 8>(1, 1);
-        constexpr auto _Tables_2_sse = _Make_tables<256, 16>(2, 2);
-        constexpr auto _Tables_4_sse = _Make_tables<16, 16>(4, 4);
-        constexpr auto _Tables_4_avx = _Make_tables<256, 8>(4, 1);
-        constexpr auto _Tables_8_sse = _Make_tables<4, 16>(8, 8);
-        constexpr auto _Tables_8_avx = _Make_tables<16, 8>(8, 2);
-
-        struct _Sse_1 {
-            static constexpr size_t _Elem_size = 1;
-            static constexpr size_t _Step      = 8;
-
-            static __m128i _Set(const uint8_t _Val) noexcept {
-                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
             }
 
-            static __m128i _Load(const void* const _Ptr) noexcept {
-                return _mm_loadu_si64(_Ptr);
+            static void _Store(void* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Val);
             }
 
-            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
-                return _mm_movemask_epi8(_mm_cmpeq_epi8(_First, _Second)) & 0xFF;
+            static __m256i _Fold(const __m256i _Val, const __m256i _Bias) noexcept {
+                // _Bias moves the letters to [-128, -103], so they are the only bytes less than -102
+                const __m256i _Letters = _mm256_cmpgt_epi8(_mm256_set1_epi8(-102), _mm256_add_epi8(_Val, _Bias));
+                return _mm256_xor_si256(_Val, _mm256_and_si256(_Letters, _mm256_set1_epi8(0x20)));
             }
 
-            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
-                const __m128i _Shuf = _mm_loadu_si64(_Tables_1_sse._Shuf[_Bingo]);
-                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
-                _mm_storeu_si64(_Out, _Dest);
-                _Advance_bytes(_Out, _Tables_1_sse._Size[_Bingo]);
-                return _Out;
+            static unsigned int _Mask_eq(const __m256i _Left, const __m256i _Right) noexcept {
+                return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Left, _Right)));
             }
         };
 
-        struct _Sse_2 {
-            static constexpr size_t _Elem_size = 2;
-            static constexpr size_t _Step      = 16;
+        struct _Traits_sse {
+            using _Guard = char;
 
-            static __m128i _Set(const uint16_t _Val) noexcept {
-                return _mm_set1_epi16(_Val);
+            static constexpr size_t _Vec_size         = 16;
+            static constexpr unsigned int _Full_mask = 0xFFFF;
+
+            static __m128i _Set(const char _Val) noexcept {
+                return _mm_set1_epi8(_Val);
             }
 
-            static __m128i _Load(const void* const _Ptr) noexcept {
-                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
             }
 
-            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
-                const __m128i _Mask = _mm_cmpeq_epi16(_First, _Second);
-                return _mm_movemask_epi8(_mm_packs_epi16(_Mask, _mm_setzero_si128()));
+            static void _Store(void* const _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
             }
 
-            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
-                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_2_sse._Shuf[_Bingo]));
-                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
-                _Advance_bytes(_Out, _Tables_2_sse._Size[_Bingo]);
-                return _Out;
+            static __m128i _Fold(const __m128i _Val, const __m128i _Bias) noexcept {
+                // _Bias moves the letters to [-128, -103], so they are the only bytes less than -102
+                const __m128i _Letters = _mm_cmpgt_epi8(_mm_set1_epi8(-102), _mm_add_epi8(_Val, _Bias));
+                return _mm_xor_si128(_Val, _mm_and_si128(_Letters, _mm_set1_epi8(0x20)));
+            }
+
+            static unsigned int _Mask_eq(const __m128i _Left, const __m128i _Right) noexcept {
+                return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Left, _Right)));
             }
         };
 
-        struct _Avx_4 {
-            static constexpr size_t _Elem_size = 4;
-            static constexpr size_t _Step      = 32;
-
-            static __m256i _Set(const uint32_t _Val) noexcept {
-                return _mm256_set1_epi32(_Val);
+        template <class _Traits>
+        void _Change_case_impl(unsigned char* _First, const size_t _Size, const char _First_letter) noexcept {
+            // _Size >= _Traits::_Vec_size; the last vector may overlap the ones before, as changing case again is
+            // a no-op
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            const auto _Bias = _Traits::_Set(static_cast<char>(0x80 - _First_letter));
+            const auto _Last = _First + _Size;
+            for (const auto _Stop = _Last - _Traits::_Vec_size; _First < _Stop; _First += _Traits::_Vec_size) {
+                _Traits::_Store(_First, _Traits::_Fold(_Traits::_Load(_First), _Bias));
             }
 
-            static __m256i _Load(const void* const _Ptr) noexcept {
-                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr));
-            }
+            _First = _Last - _Traits::_Vec_size;
+            _Traits::_Store(_First, _Traits::_Fold(_Traits::_Load(_First), _Bias));
+        }
 
-            static uint32_t _Mask(const __m256i _First, const __m256i _Second) noexcept {
-                const __m256i _Mask = _mm256_cmpeq_epi32(_First, _Second);
-                return _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
-            }
+        template <class _Traits, bool _Fold_right>
+        size_t _Mismatch_impl(
+            const unsigned char* const _First1, const unsigned char* const _First2, const size_t _Count) noexcept {
+            // _Count >= _Traits::_Vec_size; the last vector may overlap the ones before, which are known to match
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            const auto _Bias = _Traits::_Set(static_cast<char>(0x80 - 'A'));
+            size_t _Pos      = 0;
+            for (;;) {
+                const auto _Left = _Traits::_Fold(_Traits::_Load(_First1 + _Pos), _Bias);
+                auto _Right      = _Traits::_Load(_First2 + _Pos);
+                if constexpr (_Fold_right) {
+                    _Right = _Traits::_Fold(_Right, _Bias);
+                }
 
-            static void* _Store_masked(void* _Out, const __m256i _Src, const uint32_t _Bingo) noexcept {
-                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_4_avx._Shuf[_Bingo]));
-                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Src, _Shuf);
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
-                _Advance_bytes(_Out, _Tables_4_avx._Size[_Bingo]);
-                return _Out;
+                const unsigned int _Bingo = _Traits::_Mask_eq(_Left, _Right) ^ _Traits::_Full_mask;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    // CodeQL [SM02313] _Offset is always initialized: we just tested `if (_Bingo != 0)`.
+                    _BitScanForward(&_Offset, _Bingo);
+                    return _Pos + _Offset;
+                }
+
+                if (_Pos == _Count - _Traits::_Vec_size) {
+                    return _Count;
+                }
+
+                _Pos += _Traits::_Vec_size;
+                if (_Pos > _Count - _Traits::_Vec_size) {
+                    _Pos = _Count - _Traits::_Vec_size;
+                }
             }
-        };
+        }
 
-        struct _Sse_4 {
-            static constexpr size_t _Elem_size = 4;
-            static constexpr size_t _Step      = 16;
+        template <class _Traits>
+        const unsigned char* _Search_impl(const unsigned char* _First1, const unsigned char* const _Last1,
+            const unsigned char* const _First2, const size_t _Count2) noexcept {
+            // _Count2 != 0 and _Last1 - _First1 >= _Count2 + _Traits::_Vec_size - 1
+            // Candidates are the positions whose first and last characters match; only they are compared in full.
+            {
+                [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+                const auto _Bias          = _Traits::_Set(static_cast<char>(0x80 - 'A'));
+                const auto _Head          = _Traits::_Set(static_cast<char>(_First2[0]));
+                const auto _Tail          = _Traits::_Set(static_cast<char>(_First2[_Count2 - 1]));
+                const size_t _Tail_offset = _Count2 - 1;
+
+                for (const auto _Stop = _Last1 - _Tail_offset - _Traits::_Vec_size; _First1 <= _Stop;
+                    _First1 += _Traits::_Vec_size) {
+                    const auto _Data_head = _Traits::_Fold(_Traits::_Load(_First1), _Bias);
+                    const auto _Data_tail = _Traits::_Fold(_Traits::_Load(_First1 + _Tail_offset), _Bias);
+                    unsigned int _Bingo   = _Traits::_Mask_eq(_Data_head, _Head) & _Traits::_Mask_eq(_Data_tail, _Tail);
+                    while (_Bingo != 0) {
+                        unsigned long _Offset;
+                        // CodeQL [SM02313] _Offset is always initialized: we just tested `while (_Bingo != 0)`.
+                        _BitScanForward(&_Offset, _Bingo);
+                        if (_Mismatch_scalar(_First1 + _Offset, _First2, 0, _Tail_offset, false) == _Tail_offset) {
+                            return _First1 + _Offset;
+                        }
 
-            static __m128i _Set(const uint32_t _Val) noexcept {
-                return _mm_set1_epi32(_Val);
+                        _Bingo &= _Bingo - 1;
+                    }
+                }
             }
 
-            static __m128i _Load(const void* const _Ptr) noexcept {
-                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+            return _Search_scalar(_First1, _Last1, _First2, _Count2);
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        void _Change_case(void* const _First, const void* const _Last, const char _First_letter) noexcept {
+            const auto _First_ch = static_cast<unsigned char*>(_First);
+            const size_t _Size   = _Byte_length(_First, _Last);
+#ifndef _M_ARM64EC
+            if (_Size >= _Traits_avx::_Vec_size && _Use_avx2()) {
+                _Change_case_impl<_Traits_avx>(_First_ch, _Size, _First_letter);
+                return;
             }
 
-            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
-                const __m128i _Mask = _mm_cmpeq_epi32(_First, _Second);
-                return _mm_movemask_ps(_mm_castsi128_ps(_Mask));
+            if (_Size >= _Traits_sse::_Vec_size && _Use_sse42()) {
+                _Change_case_impl<_Traits_sse>(_First_ch, _Size, _First_letter);
+                return;
             }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            for (size_t _Ix = 0; _Ix != _Size; ++_Ix) {
+                _First_ch[_Ix] = _Fold_scalar(_First_ch[_Ix], static_cast<unsigned char>(_First_letter));
+            }
+        }
 
-            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
-                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_4_sse._Shuf[_Bingo]));
-                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
-                _Advance_bytes(_Out, _Tables_4_sse._Size[_Bingo]);
-                return _Out;
+        template <bool _Fold_right>
+        size_t _Mismatch(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+            const auto _First1_ch = static_cast<const unsigned char*>(_First1);
+            const auto _First2_ch = static_cast<const unsigned char*>(_First2);
+#ifndef _M_ARM64EC
+            if (_Count >= _Traits_avx::_Vec_size && _Use_avx2()) {
+                return _Mismatch_impl<_Traits_avx, _Fold_right>(_First1_ch, _First2_ch, _Count);
             }
-        };
 
-        struct _Avx_8 {
-            static constexpr size_t _Elem_size = 8;
-            static constexpr size_t _Step      = 32;
+            if (_Count >= _Traits_sse::_Vec_size && _Use_sse42()) {
+                return _Mismatch_impl<_Traits_sse, _Fold_right>(_First1_ch, _First2_ch, _Count);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            return _Mismatch_scalar(_First1_ch, _First2_ch, 0, _Count, _Fold_right);
+        }
 
-            static __m256i _Set(const uint64_t _Val) noexcept {
-                return _mm256_set1_epi64x(_Val);
+        const void* _Search(const void* const _First1, const void* const _Last1, const void* const _First2,
+            const size_t _Count2) noexcept {
+            if (_Count2 == 0) {
+                return _First1;
             }
 
-            static __m256i _Load(const void* const _Ptr) noexcept {
-                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr));
+            const size_t _Size1 = _Byte_length(_First1, _Last1);
+            if (_Size1 < _Count2) {
+                return _Last1;
             }
 
-            static uint32_t _Mask(const __m256i _First, const __m256i _Second) noexcept {
-                const __m256i _Mask = _mm256_cmpeq_epi64(_First, _Second);
-                return _mm256_movemask_pd(_mm256_castsi256_pd(_Mask));
+            const auto _First1_ch = static_cast<const unsigned char*>(_First1);
+            const auto _Last1_ch  = static_cast<const unsigned char*>(_Last1);
+            const auto _First2_ch = static_cast<const unsigned char*>(_First2);
+#ifndef _M_ARM64EC
+            if (_Size1 - _Count2 >= _Traits_avx::_Vec_size - 1 && _Use_avx2()) {
+                return _Search_impl<_Traits_avx>(_First1_ch, _Last1_ch, _First2_ch, _Count2);
             }
 
-            static void* _Store_masked(void* _Out, const __m256i _Src, const uint32_t _Bingo) noexcept {
-                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_8_avx._Shuf[_Bingo]));
-                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Src, _Shuf);
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
-                _Advance_bytes(_Out, _Tables_8_avx._Size[_Bingo]);
-                return _Out;
+            if (_Size1 - _Count2 >= _Traits_sse::_Vec_size - 1 && _Use_sse42()) {
+                return _Search_impl<_Traits_sse>(_First1_ch, _Last1_ch, _First2_ch, _Count2);
             }
-        };
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            return _Search_scalar(_First1_ch, _Last1_ch, _First2_ch, _Count2);
+        }
+    } // namespace _Ascii_case
+} // unnamed namespace
 
-        struct _Sse_8 {
-            static constexpr size_t _Elem_size = 8;
-            static constexpr size_t _Step      = 16;
+extern "C" {
 
-            static __m128i _Set(const uint64_t _Val) noexcept {
-                return _mm_set1_epi64x(_Val);
-            }
+__declspec(noalias) void __stdcall __std_ascii_tolower(void* const _First, const void* const _Last) noexcept {
+    _Ascii_case::_Change_case(_First, _Last, 'A');
+}
 
-            static __m128i _Load(const void* const _Ptr) noexcept {
-                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+__declspec(noalias) void __stdcall __std_ascii_toupper(void* const _First, const void* const _Last) noexcept {
+    _Ascii_case::_Change_case(_First, _Last, 'a');
+}
+
+__declspec(noalias) size_t __stdcall __std_mismatch_ascii_icase(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Ascii_case::_Mismatch<true>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __stdcall __std_mismatch_ascii_icase_left(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Ascii_case::_Mismatch<false>(_First1, _First2, _Count);
+}
+
+const void* __stdcall __std_search_ascii_icase_left(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return _Ascii_case::_Search(_First1, _Last1, _First2, _Count2);
+}
+
+} // extern "C"
+
+namespace {
+    namespace _Transcoding {
+        // These convert only complete, well-formed sequences (no overlong forms, surrogates or values above
+        // 0x10FFFF in UTF-8, no unpaired surrogates in UTF-16) and stop before anything else, leaving it to the
+        // caller's own rules. Vectorized steps may store past the converted output, within [_Dest, _Dest_last).
+
+        bool _Utf8_step(const unsigned char*& _Src, const unsigned char* const _Src_last, char16_t*& _Dest,
+            const char16_t* const _Dest_last) noexcept {
+            // _Src != _Src_last and _Dest != _Dest_last
+            const unsigned int _Lead = _Src[0];
+            const size_t _Avail      = static_cast<size_t>(_Src_last - _Src);
+            if (_Lead < 0x80) {
+                *_Dest++ = static_cast<char16_t>(_Lead);
+                ++_Src;
+                return true;
             }
 
-            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
-                const __m128i _Mask = _mm_cmpeq_epi64(_First, _Second);
-                return _mm_movemask_pd(_mm_castsi128_pd(_Mask));
+            if (_Lead < 0xC2) { // trailing byte, or overlong 2-byte sequence
+                return false;
             }
 
-            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
-                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_8_sse._Shuf[_Bingo]));
-                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
-                _Advance_bytes(_Out, _Tables_8_sse._Size[_Bingo]);
-                return _Out;
+            if (_Lead < 0xE0) {
+                if (_Avail < 2 || (_Src[1] & 0xC0) != 0x80) {
+                    return false;
+                }
+
+                *_Dest++ = static_cast<char16_t>(((_Lead & 0x1F) << 6) | (_Src[1] & 0x3F));
+                _Src += 2;
+                return true;
             }
-        };
 
-        constexpr size_t _Copy_buffer_size = 512;
+            if (_Lead < 0xF0) {
+                if (_Avail < 3 || (_Src[1] & 0xC0) != 0x80 || (_Src[2] & 0xC0) != 0x80) {
+                    return false;
+                }
 
-        template <class _Traits, class _Ty>
-        void* _Remove_impl(void* _First, void* const _Stop, const _Ty _Val) noexcept {
-            void* _Out        = _First;
-            const auto _Match = _Traits::_Set(_Val);
+                const unsigned int _Code_point = ((_Lead & 0x0F) << 12) | ((_Src[1] & 0x3F) << 6) | (_Src[2] & 0x3F);
+                if (_Code_point < 0x800 || (_Code_point & 0xF800) == 0xD800) {
+                    return false;
+                }
 
-            do {
-                const auto _Src       = _Traits::_Load(_First);
-                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
-                _Out                  = _Traits::_Store_masked(_Out, _Src, _Bingo);
-                _Advance_bytes(_First, _Traits::_Step);
-            } while (_First != _Stop);
+                *_Dest++ = static_cast<char16_t>(_Code_point);
+                _Src += 3;
+                return true;
+            }
 
-            return _Out;
+            if (_Avail < 4 || _Dest_last - _Dest < 2 || (_Src[1] & 0xC0) != 0x80 || (_Src[2] & 0xC0) != 0x80
+                || (_Src[3] & 0xC0) != 0x80) {
+                return false;
+            }
+
+            const unsigned int _Code_point =
+                ((_Lead & 0x07) << 18) | ((_Src[1] & 0x3F) << 12) | ((_Src[2] & 0x3F) << 6) | (_Src[3] & 0x3F);
+            if (_Lead > 0xF4 || _Code_point < 0x10000 || _Code_point > 0x10FFFF) {
+                return false;
+            }
+
+            *_Dest++ = static_cast<char16_t>(0xD7C0 + (_Code_point >> 10));
+            *_Dest++ = static_cast<char16_t>(0xDC00 | (_Code_point & 0x3FF));
+            _Src += 4;
+            return true;
         }
 
-        template <class _Traits, class _Ty>
-        void* _Remove_copy_impl(const void* _First, const void* const _Stop, void* _Out, const _Ty _Val) noexcept {
-            unsigned char _Buffer[_Copy_buffer_size];
-            void* _Buffer_out        = _Buffer;
-            void* const _Buffer_stop = _Buffer + _Copy_buffer_size - _Traits::_Step;
+        bool _Utf16_step(const char16_t*& _Src, const char16_t* const _Src_last, unsigned char*& _Dest,
+            const unsigned char* const _Dest_last) noexcept {
+            // _Src != _Src_last and _Dest != _Dest_last
+            const unsigned int _Unit = _Src[0];
+            const size_t _Room       = static_cast<size_t>(_Dest_last - _Dest);
+            if (_Unit < 0x80) {
+                *_Dest++ = static_cast<unsigned char>(_Unit);
+                ++_Src;
+                return true;
+            }
 
-            const auto _Match = _Traits::_Set(_Val);
+            if (_Unit < 0x800) {
+                if (_Room < 2) {
+                    return false;
+                }
 
-            do {
-                const auto _Src       = _Traits::_Load(_First);
-                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
-                _Buffer_out           = _Traits::_Store_masked(_Buffer_out, _Src, _Bingo);
-                _Advance_bytes(_First, _Traits::_Step);
+                *_Dest++ = static_cast<unsigned char>(0xC0 | (_Unit >> 6));
+                *_Dest++ = static_cast<unsigned char>(0x80 | (_Unit & 0x3F));
+                ++_Src;
+                return true;
+            }
 
-                if (_Buffer_out >= _Buffer_stop) {
-                    const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
-                    memcpy(_Out, _Buffer, _Fill);
-                    _Advance_bytes(_Out, _Fill);
-                    _Buffer_out = _Buffer;
+            if ((_Unit & 0xF800) != 0xD800) {
+                if (_Room < 3) {
+                    return false;
                 }
-            } while (_First != _Stop);
 
-            const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
-            memcpy(_Out, _Buffer, _Fill);
-            _Advance_bytes(_Out, _Fill);
-            return _Out;
-        }
+                *_Dest++ = static_cast<unsigned char>(0xE0 | (_Unit >> 12));
+                *_Dest++ = static_cast<unsigned char>(0x80 | ((_Unit >> 6) & 0x3F));
+                *_Dest++ = static_cast<unsigned char>(0x80 | (_Unit & 0x3F));
+                ++_Src;
+                return true;
+            }
 
-        template <class _Traits>
-        void* _Unique_impl(void* _First, void* const _Stop) noexcept {
-            void* _Out = _First;
+            if (_Unit >= 0xDC00 || _Src_last - _Src < 2 || (_Src[1] & 0xFC00) != 0xDC00 || _Room < 4) {
+                return false;
+            }
 
-            do {
-                const auto _Src = _Traits::_Load(_First);
-                void* _First_d  = _First;
-                _Rewind_bytes(_First_d, _Traits::_Elem_size);
-                const auto _Match     = _Traits::_Load(_First_d);
-                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
-                _Out                  = _Traits::_Store_masked(_Out, _Src, _Bingo);
-                _Advance_bytes(_First, _Traits::_Step);
-            } while (_First != _Stop);
+            const unsigned int _Code_point = 0x10000 + ((_Unit & 0x3FF) << 10) + (_Src[1] & 0x3FF);
+            *_Dest++                       = static_cast<unsigned char>(0xF0 | (_Code_point >> 18));
+            *_Dest++                       = static_cast<unsigned char>(0x80 | ((_Code_point >> 12) & 0x3F));
+            *_Dest++                       = static_cast<unsigned char>(0x80 | ((_Code_point >> 6) & 0x3F));
+            *_Dest++                       = static_cast<unsigned char>(0x80 | (_Code_point & 0x3F));
+            _Src += 2;
+            return true;
+        }
 
-            _Rewind_bytes(_Out, _Traits::_Elem_size);
-            return _Out;
+#ifndef _M_ARM64EC
+        unsigned long _Lowest_set(const unsigned int _Mask) noexcept {
+            unsigned long _Pos;
+            // CodeQL [SM02313] _Pos is always initialized: callers pass a nonzero _Mask.
+            _BitScanForward(&_Pos, _Mask);
+            return _Pos;
         }
 
-        template <class _Traits>
-        void* _Unique_copy_impl(const void* _First, const void* const _Stop, void* _Out) noexcept {
-            unsigned char _Buffer[_Copy_buffer_size];
-            void* _Buffer_out        = _Buffer;
-            void* const _Buffer_stop = _Buffer + _Copy_buffer_size - _Traits::_Step;
+        bool _Utf8_step_sse(const unsigned char*& _Src, char16_t*& _Dest) noexcept {
+            // 16 bytes can be read from _Src, and 16 code units written to _Dest
+            const __m128i _Data      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            const __m128i _Zero      = _mm_setzero_si128();
+            const unsigned int _Mask = static_cast<unsigned int>(_mm_movemask_epi8(_Data));
+            if (_Mask != 0xFFFF) { // some ASCII
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _mm_unpacklo_epi8(_Data, _Zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest) + 1, _mm_unpackhi_epi8(_Data, _Zero));
+                if (_Mask == 0) {
+                    _Src += 16;
+                    _Dest += 16;
+                    return true;
+                }
 
-            do {
-                const auto _Src      = _Traits::_Load(_First);
-                const void* _First_d = _First;
-                _Rewind_bytes(_First_d, _Traits::_Elem_size);
-                const auto _Match     = _Traits::_Load(_First_d);
-                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
-                _Buffer_out           = _Traits::_Store_masked(_Buffer_out, _Src, _Bingo);
-                _Advance_bytes(_First, _Traits::_Step);
+                const unsigned long _Count = _Lowest_set(_Mask);
+                if (_Count != 0) {
+                    _Src += _Count;
+                    _Dest += _Count;
+                    return true;
+                }
+            }
 
-                if (_Buffer_out >= _Buffer_stop) {
-                    const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
-                    memcpy(static_cast<unsigned char*>(_Out) + _Traits::_Elem_size, _Buffer, _Fill);
-                    _Advance_bytes(_Out, _Fill);
-                    _Buffer_out = _Buffer;
+            // 2-byte sequences: each 16-bit lane is a lead byte in [C2, DF] followed by a trailing byte
+            {
+                const __m128i _Bits     = _mm_and_si128(_Data, _mm_set1_epi16(static_cast<short>(0xC0E0)));
+                const __m128i _Form_ok  = _mm_cmpeq_epi16(_Bits, _mm_set1_epi16(static_cast<short>(0x80C0)));
+                const __m128i _Overlong = _mm_cmpeq_epi16(_mm_and_si128(_Data, _mm_set1_epi16(0x001E)), _Zero);
+                const __m128i _Valid    = _mm_andnot_si128(_Overlong, _Form_ok);
+                const unsigned long _Count =
+                    _Lowest_set(~static_cast<unsigned int>(_mm_movemask_epi8(_Valid))) / 2;
+                if (_Count != 0) {
+                    const __m128i _High = _mm_slli_epi16(_mm_and_si128(_Data, _mm_set1_epi16(0x001F)), 6);
+                    const __m128i _Low  = _mm_and_si128(_mm_srli_epi16(_Data, 8), _mm_set1_epi16(0x003F));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _mm_or_si128(_High, _Low));
+                    _Src += _Count * 2;
+                    _Dest += _Count;
+                    return true;
                 }
-            } while (_First != _Stop);
+            }
 
-            const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
-            memcpy(static_cast<unsigned char*>(_Out) + _Traits::_Elem_size, _Buffer, _Fill);
-            _Advance_bytes(_Out, _Fill);
-            return _Out;
+            // 3-byte sequences: each 32-bit lane gets the bytes of one of the first four, the lead byte in bits 16-23
+            {
+                const __m128i _Shuf = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+                const __m128i _Seqs = _mm_shuffle_epi8(_Data, _Shuf);
+                const __m128i _High        = _mm_and_si128(_mm_srli_epi32(_Seqs, 4), _mm_set1_epi32(0xF000));
+                const __m128i _Middle      = _mm_and_si128(_mm_srli_epi32(_Seqs, 2), _mm_set1_epi32(0x0FC0));
+                const __m128i _Low         = _mm_and_si128(_Seqs, _mm_set1_epi32(0x003F));
+                const __m128i _Code_points = _mm_or_si128(_mm_or_si128(_High, _Middle), _Low);
+                const __m128i _Form_ok = _mm_cmpeq_epi32(
+                    _mm_and_si128(_Seqs, _mm_set1_epi32(0x00F0'C0C0)), _mm_set1_epi32(0x00E0'8080));
+                const __m128i _Not_overlong = _mm_cmpgt_epi32(_Code_points, _mm_set1_epi32(0x07FF));
+                const __m128i _Surrogate    = _mm_cmpeq_epi32(
+                    _mm_and_si128(_Code_points, _mm_set1_epi32(0xF800)), _mm_set1_epi32(0xD800));
+                const __m128i _Valid = _mm_andnot_si128(_Surrogate, _mm_and_si128(_Form_ok, _Not_overlong));
+                const unsigned long _Count =
+                    _Lowest_set(~static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_Valid))));
+                if (_Count != 0) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _mm_packus_epi32(_Code_points, _Code_points));
+                    _Src += _Count * 3;
+                    _Dest += _Count;
+                    return true;
+                }
+            }
+
+            return _Utf8_step(_Src, _Src + 16, _Dest, _Dest + 16);
         }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
-    } // namespace _Removing
-} // unnamed namespace
 
-extern "C" {
+        bool _Utf16_step_sse(const char16_t*& _Src, unsigned char*& _Dest) noexcept {
+            // 8 code units can be read from _Src, and 16 bytes written to _Dest
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            const __m128i _Zero = _mm_setzero_si128();
+            const __m128i _Ascii =
+                _mm_cmpeq_epi16(_mm_and_si128(_Data, _mm_set1_epi16(static_cast<short>(0xFF80))), _Zero);
+            const unsigned int _Ascii_mask = static_cast<unsigned int>(_mm_movemask_epi8(_Ascii));
+            if (_Ascii_mask != 0) { // some ASCII
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(_Dest), _mm_packus_epi16(_Data, _Data));
+                const unsigned long _Count = _Lowest_set(~_Ascii_mask) / 2;
+                if (_Count != 0) {
+                    _Src += _Count;
+                    _Dest += _Count;
+                    return true;
+                }
+            }
 
-void* __stdcall __std_remove_1(void* _First, void* const _Last, const uint8_t _Val) noexcept {
-    void* _Out = _First;
+            const __m128i _Top = _mm_and_si128(_Data, _mm_set1_epi16(static_cast<short>(0xF800)));
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
-        _Out   = _Removing::_Remove_impl<_Removing::_Sse_1>(_First, _Stop, _Val);
-        _First = _Stop;
-    }
+            // code units in [80, 7FF] become 2 bytes
+            {
+                const __m128i _Two      = _mm_andnot_si128(_Ascii, _mm_cmpeq_epi16(_Top, _Zero));
+                const unsigned long _Count =
+                    _Lowest_set(~static_cast<unsigned int>(_mm_movemask_epi8(_Two))) / 2;
+                if (_Count != 0) {
+                    const __m128i _Lead  = _mm_or_si128(_mm_srli_epi16(_Data, 6), _mm_set1_epi16(0x00C0));
+                    const __m128i _Trail = _mm_slli_epi16(_mm_and_si128(_Data, _mm_set1_epi16(0x003F)), 8);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest),
+                        _mm_or_si128(_mm_or_si128(_Lead, _Trail), _mm_set1_epi16(static_cast<short>(0x8000))));
+                    _Src += _Count;
+                    _Dest += _Count * 2;
+                    return true;
+                }
+            }
+
+            // other code units, except surrogates, become 3 bytes; the first four are handled at once
+            {
+                const __m128i _Surrogate = _mm_cmpeq_epi16(_Top, _mm_set1_epi16(static_cast<short>(0xD800)));
+                const __m128i _Other     = _mm_or_si128(_mm_cmpeq_epi16(_Top, _Zero), _Surrogate);
+                const unsigned long _Count =
+                    _Lowest_set(static_cast<unsigned int>(_mm_movemask_epi8(_Other)) | 0x100) / 2;
+                if (_Count != 0) {
+                    const __m128i _Units  = _mm_cvtepu16_epi32(_Data);
+                    const __m128i _Lead   = _mm_srli_epi32(_Units, 12);
+                    const __m128i _Trail1 = _mm_and_si128(_mm_slli_epi32(_Units, 2), _mm_set1_epi32(0x3F00));
+                    const __m128i _Trail2 = _mm_and_si128(_mm_slli_epi32(_Units, 16), _mm_set1_epi32(0x3F'0000));
+                    const __m128i _Bytes  = _mm_or_si128(
+                        _mm_or_si128(_Lead, _Trail1), _mm_or_si128(_Trail2, _mm_set1_epi32(0x80'80E0)));
+                    const __m128i _Shuf = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _mm_shuffle_epi8(_Bytes, _Shuf));
+                    _Src += _Count;
+                    _Dest += _Count * 3;
+                    return true;
+                }
+            }
+
+            return _Utf16_step(_Src, _Src + 8, _Dest, _Dest + 16);
+        }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+        void _Utf8_to_utf16(const void** const _First1, const void* const _Last1, void** const _First2,
+            const void* const _Last2) noexcept {
+            auto _Src             = static_cast<const unsigned char*>(*_First1);
+            const auto _Src_last  = static_cast<const unsigned char*>(_Last1);
+            auto _Dest            = static_cast<char16_t*>(*_First2);
+            const auto _Dest_last = static_cast<const char16_t*>(_Last2);
+#ifndef _M_ARM64EC
+            if (_Use_sse42()) {
+                while (_Src_last - _Src >= 16 && _Dest_last - _Dest >= 16) {
+                    if (!_Utf8_step_sse(_Src, _Dest)) {
+                        break;
+                    }
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            while (_Src != _Src_last && _Dest != _Dest_last && _Utf8_step(_Src, _Src_last, _Dest, _Dest_last)) {
+            }
 
-void* __stdcall __std_remove_2(void* _First, void* const _Last, const uint16_t _Val) noexcept {
-    void* _Out = _First;
+            *_First1 = _Src;
+            *_First2 = _Dest;
+        }
 
+        void _Utf16_to_utf8(const void** const _First1, const void* const _Last1, void** const _First2,
+            const void* const _Last2) noexcept {
+            auto _Src             = static_cast<const char16_t*>(*_First1);
+            const auto _Src_last  = static_cast<const char16_t*>(_Last1);
+            auto _Dest            = static_cast<unsigned char*>(*_First2);
+            const auto _Dest_last = static_cast<const unsigned char*>(_Last2);
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Out   = _Removing::_Remove_impl<_Removing::_Sse_2>(_First, _Stop, _Val);
-        _First = _Stop;
-    }
+            if (_Use_sse42()) {
+                while (_Src_last - _Src >= 8 && _Dest_last - _Dest >= 16) {
+                    if (!_Utf16_step_sse(_Src, _Dest)) {
+                        break;
+                    }
+                }
+            }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
+            while (_Src != _Src_last && _Dest != _Dest_last && _Utf16_step(_Src, _Src_last, _Dest, _Dest_last)) {
+            }
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+            *_First1 = _Src;
+            *_First2 = _Dest;
+        }
+    } // namespace _Transcoding
+} // unnamed namespace
+
+extern "C" {
+
+void __stdcall __std_utf8_to_utf16(
+    const void** const _First1, const void* const _Last1, void** const _First2, const void* const _Last2) noexcept {
+    _Transcoding::_Utf8_to_utf16(_First1, _Last1, _First2, _Last2);
 }
 
-void* __stdcall __std_remove_4(void* _First, void* const _Last, const uint32_t _Val) noexcept {
-    void* _Out = _First;
+void __stdcall __std_utf16_to_utf8(
+    const void** const _First1, const void* const _Last1, void** const _First2, const void* const _Last2) noexcept {
+    _Transcoding::_Utf16_to_utf8(_First1, _Last1, _First2, _Last2);
+}
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Out   = _Removing::_Remove_impl<_Removing::_Avx_4>(_First, _Stop, _Val);
-        _First = _Stop;
+} // extern "C"
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Out   = _Removing::_Remove_impl<_Removing::_Sse_4>(_First, _Stop, _Val);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+namespace {
+    namespace _Removing {
+        template <class _Ty>
+        void* _Remove_fallback(
+            const void* const _First, const void* const _Last, void* const _Out, const _Ty _Val) noexcept {
+            const _Ty* _Src = reinterpret_cast<const _Ty*>(_First);
+            _Ty* _Dest      = reinterpret_cast<_Ty*>(_Out);
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+            while (_Src != _Last) {
+                if (*_Src != _Val) {
+                    *_Dest = *_Src;
+                    ++_Dest;
+                }
 
-void* __stdcall __std_remove_8(void* _First, void* const _Last, const uint64_t _Val) noexcept {
-    void* _Out = _First;
+                ++_Src;
+            }
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Out   = _Removing::_Remove_impl<_Removing::_Avx_8>(_First, _Stop, _Val);
-        _First = _Stop;
+            return _Dest;
+        }
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Out   = _Removing::_Remove_impl<_Removing::_Sse_8>(_First, _Stop, _Val);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        template <class _Ty>
+        void* _Unique_fallback(const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+            _Ty* _Out       = reinterpret_cast<_Ty*>(_Dest);
+            const _Ty* _Src = reinterpret_cast<const _Ty*>(_First);
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+            while (_Src != _Last) {
+                if (*_Src != *_Out) {
+                    ++_Out;
+                    *_Out = *_Src;
+                }
 
-void* __stdcall __std_remove_copy_1(
-    const void* _First, const void* const _Last, void* _Out, const uint8_t _Val) noexcept {
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
-        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_1>(_First, _Stop, _Out, _Val);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+                ++_Src;
+            }
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+            ++_Out;
+            return _Out;
+        }
 
-void* __stdcall __std_remove_copy_2(
-    const void* _First, const void* const _Last, void* _Out, const uint16_t _Val) noexcept {
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_2>(_First, _Stop, _Out, _Val);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        template <size_t _Size_v, size_t _Size_h>
+        struct _Tables {
+            uint8_t _Shuf[_Size_v][_Size_h];
+            uint8_t _Size[_Size_v];
+        };
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+        template <size_t _Size_v, size_t _Size_h>
+        constexpr auto _Make_tables(const uint32_t _Mul, const uint32_t _Ew) {
+            _Tables<_Size_v, _Size_h> _Result;
 
-void* __stdcall __std_remove_copy_4(
-    const void* _First, const void* const _Last, void* _Out, const uint32_t _Val) noexcept {
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx_4>(_First, _Stop, _Out, _Val);
-        _First = _Stop;
+            for (uint32_t _Vx = 0; _Vx != _Size_v; ++_Vx) {
+                uint32_t _Nx = 0;
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_4>(_First, _Stop, _Out, _Val);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+                // Make shuffle mask for pshufb / vpermd corresponding to _Vx bit value.
+                // Every bit set corresponds to an element skipped.
+                for (uint32_t _Hx = 0; _Hx != _Size_h / _Ew; ++_Hx) {
+                    if ((_Vx & (1 << _Hx)) == 0) {
+                        // Inner loop needed for cases where the shuffle mask operates on element parts rather than
+                        // whole elements; for whole elements there would be one iteration.
+                        for (uint32_t _Ex = 0; _Ex != _Ew; ++_Ex) {
+                            _Result._Shuf[_Vx][_Nx * _Ew + _Ex] = static_cast<uint8_t>(_Hx * _Ew + _Ex);
+                        }
+                        ++_Nx;
+                    }
+                }
+
+                // Size of elements that are not removed in bytes.
+                _Result._Size[_Vx] = static_cast<uint8_t>(_Nx * _Mul);
+
+                // Fill the remaining with arbitrary elements.
+                // It is not possible to leave them untouched while keeping this optimization efficient.
+                // This should not be a problem though, as they should be either overwritten by the next step,
+                // or left in the removed range.
+                for (; _Nx != _Size_h / _Ew; ++_Nx) {
+                    // Inner loop needed for cases where the shuffle mask operates on element parts rather than whole
+                    // elements; for whole elements there would be one iteration.
+                    for (uint32_t _Ex = 0; _Ex != _Ew; ++_Ex) {
+                        _Result._Shuf[_Vx][_Nx * _Ew + _Ex] = static_cast<uint8_t>(_Nx * _Ew + _Ex);
+                    }
+                }
+            }
+
+            return _Result;
+        }
+
+        constexpr auto _Tables_1_sse = _Make_tables<256, 8>(1, 1);
+        constexpr auto _Tables_2_sse = _Make_tables<256, 16>(2, 2);
+        constexpr auto _Tables_4_sse = _Make_tables<16, 16>(4, 4);
+        constexpr auto _Tables_4_avx = _Make_tables<256, 8>(4, 1);
+        constexpr auto _Tables_8_sse = _Make_tables<4, 16>(8, 8);
+        constexpr auto _Tables_8_avx = _Make_tables<16, 8>(8, 2);
+
+        struct _Sse_1 {
+            static constexpr size_t _Elem_size = 1;
+            static constexpr size_t _Step      = 8;
+
+            static __m128i _Set(const uint8_t _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static __m128i _Load(const void* const _Ptr) noexcept {
+                return _mm_loadu_si64(_Ptr);
+            }
+
+            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_epi8(_mm_cmpeq_epi8(_First, _Second)) & 0xFF;
+            }
+
+            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si64(_Tables_1_sse._Shuf[_Bingo]);
+                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+                _mm_storeu_si64(_Out, _Dest);
+                _Advance_bytes(_Out, _Tables_1_sse._Size[_Bingo]);
+                return _Out;
+            }
+        };
+
+        struct _Sse_2 {
+            static constexpr size_t _Elem_size = 2;
+            static constexpr size_t _Step      = 16;
+
+            static __m128i _Set(const uint16_t _Val) noexcept {
+                return _mm_set1_epi16(_Val);
+            }
+
+            static __m128i _Load(const void* const _Ptr) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+            }
+
+            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
+                const __m128i _Mask = _mm_cmpeq_epi16(_First, _Second);
+                return _mm_movemask_epi8(_mm_packs_epi16(_Mask, _mm_setzero_si128()));
+            }
+
+            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_2_sse._Shuf[_Bingo]));
+                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
+                _Advance_bytes(_Out, _Tables_2_sse._Size[_Bingo]);
+                return _Out;
+            }
+        };
+
+        struct _Avx_4 {
+            static constexpr size_t _Elem_size = 4;
+            static constexpr size_t _Step      = 32;
+
+            static __m256i _Set(const uint32_t _Val) noexcept {
+                return _mm256_set1_epi32(_Val);
+            }
+
+            static __m256i _Load(const void* const _Ptr) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr));
+            }
+
+            static uint32_t _Mask(const __m256i _First, const __m256i _Second) noexcept {
+                const __m256i _Mask = _mm256_cmpeq_epi32(_First, _Second);
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+            }
+
+            static void* _Store_masked(void* _Out, const __m256i _Src, const uint32_t _Bingo) noexcept {
+                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_4_avx._Shuf[_Bingo]));
+                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Src, _Shuf);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
+                _Advance_bytes(_Out, _Tables_4_avx._Size[_Bingo]);
+                return _Out;
+            }
+        };
+
+        struct _Sse_4 {
+            static constexpr size_t _Elem_size = 4;
+            static constexpr size_t _Step      = 16;
+
+            static __m128i _Set(const uint32_t _Val) noexcept {
+                return _mm_set1_epi32(_Val);
+            }
+
+            static __m128i _Load(const void* const _Ptr) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+            }
+
+            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
+                const __m128i _Mask = _mm_cmpeq_epi32(_First, _Second);
+                return _mm_movemask_ps(_mm_castsi128_ps(_Mask));
+            }
+
+            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_4_sse._Shuf[_Bingo]));
+                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
+                _Advance_bytes(_Out, _Tables_4_sse._Size[_Bingo]);
+                return _Out;
+            }
+        };
+
+        struct _Avx_8 {
+            static constexpr size_t _Elem_size = 8;
+            static constexpr size_t _Step      = 32;
+
+            static __m256i _Set(const uint64_t _Val) noexcept {
+                return _mm256_set1_epi64x(_Val);
+            }
+
+            static __m256i _Load(const void* const _Ptr) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr));
+            }
+
+            static uint32_t _Mask(const __m256i _First, const __m256i _Second) noexcept {
+                const __m256i _Mask = _mm256_cmpeq_epi64(_First, _Second);
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_Mask));
+            }
+
+            static void* _Store_masked(void* _Out, const __m256i _Src, const uint32_t _Bingo) noexcept {
+                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_8_avx._Shuf[_Bingo]));
+                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Src, _Shuf);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
+                _Advance_bytes(_Out, _Tables_8_avx._Size[_Bingo]);
+                return _Out;
+            }
+        };
+
+        struct _Sse_8 {
+            static constexpr size_t _Elem_size = 8;
+            static constexpr size_t _Step      = 16;
+
+            static __m128i _Set(const uint64_t _Val) noexcept {
+                return _mm_set1_epi64x(_Val);
+            }
+
+            static __m128i _Load(const void* const _Ptr) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Ptr));
+            }
+
+            static uint32_t _Mask(const __m128i _First, const __m128i _Second) noexcept {
+                const __m128i _Mask = _mm_cmpeq_epi64(_First, _Second);
+                return _mm_movemask_pd(_mm_castsi128_pd(_Mask));
+            }
+
+            static void* _Store_masked(void* _Out, const __m128i _Src, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_8_sse._Shuf[_Bingo]));
+                const __m128i _Dest = _mm_shuffle_epi8(_Src, _Shuf);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out), _Dest);
+                _Advance_bytes(_Out, _Tables_8_sse._Size[_Bingo]);
+                return _Out;
+            }
+        };
+
+        constexpr size_t _Copy_buffer_size = 512;
+
+        template <class _Traits, class _Ty>
+        void* _Remove_impl(void* _First, void* const _Stop, const _Ty _Val) noexcept {
+            void* _Out        = _First;
+            const auto _Match = _Traits::_Set(_Val);
+
+            do {
+                const auto _Src       = _Traits::_Load(_First);
+                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
+                _Out                  = _Traits::_Store_masked(_Out, _Src, _Bingo);
+                _Advance_bytes(_First, _Traits::_Step);
+            } while (_First != _Stop);
+
+            return _Out;
+        }
+
+        template <class _Traits, class _Ty>
+        void* _Remove_copy_impl(const void* _First, const void* const _Stop, void* _Out, const _Ty _Val) noexcept {
+            unsigned char _Buffer[_Copy_buffer_size];
+            void* _Buffer_out        = _Buffer;
+            void* const _Buffer_stop = _Buffer + _Copy_buffer_size - _Traits::_Step;
+
+            const auto _Match = _Traits::_Set(_Val);
+
+            do {
+                const auto _Src       = _Traits::_Load(_First);
+                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
+                _Buffer_out           = _Traits::_Store_masked(_Buffer_out, _Src, _Bingo);
+                _Advance_bytes(_First, _Traits::_Step);
+
+                if (_Buffer_out >= _Buffer_stop) {
+                    const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
+                    memcpy(_Out, _Buffer, _Fill);
+                    _Advance_bytes(_Out, _Fill);
+                    _Buffer_out = _Buffer;
+                }
+            } while (_First != _Stop);
+
+            const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
+            memcpy(_Out, _Buffer, _Fill);
+            _Advance_bytes(_Out, _Fill);
+            return _Out;
+        }
+
+        template <class _Traits>
+        void* _Unique_impl(void* _First, void* const _Stop) noexcept {
+            void* _Out = _First;
+
+            do {
+                const auto _Src = _Traits::_Load(_First);
+                void* _First_d  = _First;
+                _Rewind_bytes(_First_d, _Traits::_Elem_size);
+                const auto _Match     = _Traits::_Load(_First_d);
+                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
+                _Out                  = _Traits::_Store_masked(_Out, _Src, _Bingo);
+                _Advance_bytes(_First, _Traits::_Step);
+            } while (_First != _Stop);
+
+            _Rewind_bytes(_Out, _Traits::_Elem_size);
+            return _Out;
+        }
+
+        template <class _Traits>
+        void* _Unique_copy_impl(const void* _First, const void* const _Stop, void* _Out) noexcept {
+            unsigned char _Buffer[_Copy_buffer_size];
+            void* _Buffer_out        = _Buffer;
+            void* const _Buffer_stop = _Buffer + _Copy_buffer_size - _Traits::_Step;
+
+            do {
+                const auto _Src      = _Traits::_Load(_First);
+                const void* _First_d = _First;
+                _Rewind_bytes(_First_d, _Traits::_Elem_size);
+                const auto _Match     = _Traits::_Load(_First_d);
+                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
+                _Buffer_out           = _Traits::_Store_masked(_Buffer_out, _Src, _Bingo);
+                _Advance_bytes(_First, _Traits::_Step);
+
+                if (_Buffer_out >= _Buffer_stop) {
+                    const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
+                    memcpy(static_cast<unsigned char*>(_Out) + _Traits::_Elem_size, _Buffer, _Fill);
+                    _Advance_bytes(_Out, _Fill);
+                    _Buffer_out = _Buffer;
+                }
+            } while (_First != _Stop);
+
+            const size_t _Fill = _Byte_length(_Buffer, _Buffer_out);
+            memcpy(static_cast<unsigned char*>(_Out) + _Traits::_Elem_size, _Buffer, _Fill);
+            _Advance_bytes(_Out, _Fill);
+            return _Out;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+    } // namespace _Removing
+} // unnamed namespace
+
+extern "C" {
+
+void* __stdcall __std_remove_1(void* _First, void* const _Last, const uint8_t _Val) noexcept {
+    void* _Out = _First;
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
+        _Out   = _Removing::_Remove_impl<_Removing::_Sse_1>(_First, _Stop, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_2(void* _First, void* const _Last, const uint16_t _Val) noexcept {
+    void* _Out = _First;
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Out   = _Removing::_Remove_impl<_Removing::_Sse_2>(_First, _Stop, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_4(void* _First, void* const _Last, const uint32_t _Val) noexcept {
+    void* _Out = _First;
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Out   = _Removing::_Remove_impl<_Removing::_Avx_4>(_First, _Stop, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Out   = _Removing::_Remove_impl<_Removing::_Sse_4>(_First, _Stop, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_8(void* _First, void* const _Last, const uint64_t _Val) noexcept {
+    void* _Out = _First;
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Out   = _Removing::_Remove_impl<_Removing::_Avx_8>(_First, _Stop, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Out   = _Removing::_Remove_impl<_Removing::_Sse_8>(_First, _Stop, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_copy_1(
+    const void* _First, const void* const _Last, void* _Out, const uint8_t _Val) noexcept {
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_1>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_copy_2(
+    const void* _First, const void* const _Last, void* _Out, const uint16_t _Val) noexcept {
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_2>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_copy_4(
+    const void* _First, const void* const _Last, void* _Out, const uint32_t _Val) noexcept {
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx_4>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_4>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_remove_copy_8(
+    const void* _First, const void* const _Last, void* _Out, const uint64_t _Val) noexcept {
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx_8>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_8>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
+}
+
+void* __stdcall __std_unique_1(void* _First, void* const _Last) noexcept {
+    _First = const_cast<void*>(__std_adjacent_find_1(_First, _Last));
+
+    if (_First == _Last) {
+        return _First;
+    }
+
+    void* _Dest = _First;
+    _Advance_bytes(_First, 1);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_1>(_First, _Stop);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint8_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_2(void* _First, void* const _Last) noexcept {
+    _First = const_cast<void*>(__std_adjacent_find_2(_First, _Last));
+
+    if (_First == _Last) {
+        return _First;
+    }
+
+    void* _Dest = _First;
+    _Advance_bytes(_First, 2);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_2>(_First, _Stop);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint16_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_4(void* _First, void* const _Last) noexcept {
+    _First = const_cast<void*>(__std_adjacent_find_4(_First, _Last));
+
+    if (_First == _Last) {
+        return _First;
+    }
+
+    void* _Dest = _First;
+    _Advance_bytes(_First, 4);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Avx_4>(_First, _Stop);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_4>(_First, _Stop);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint32_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_8(void* _First, void* const _Last) noexcept {
+    _First = const_cast<void*>(__std_adjacent_find_8(_First, _Last));
+
+    if (_First == _Last) {
+        return _First;
+    }
+
+    void* _Dest = _First;
+    _Advance_bytes(_First, 8);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Avx_8>(_First, _Stop);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_8>(_First, _Stop);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint64_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_1(const void* _First, const void* const _Last, void* _Dest) noexcept {
+    if (_First == _Last) {
+        return _Dest;
+    }
+
+    memcpy(_Dest, _First, 1);
+    _Advance_bytes(_First, 1);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_1>(_First, _Stop, _Dest);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint8_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_2(const void* _First, const void* const _Last, void* _Dest) noexcept {
+    if (_First == _Last) {
+        return _Dest;
+    }
+
+    memcpy(_Dest, _First, 2);
+    _Advance_bytes(_First, 2);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_2>(_First, _Stop, _Dest);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint16_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_4(const void* _First, const void* const _Last, void* _Dest) noexcept {
+    if (_First == _Last) {
+        return _Dest;
+    }
+
+    memcpy(_Dest, _First, 4);
+    _Advance_bytes(_First, 4);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx_4>(_First, _Stop, _Dest);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_4>(_First, _Stop, _Dest);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint32_t>(_First, _Last, _Dest);
+}
+
+void* __stdcall __std_unique_copy_8(const void* _First, const void* const _Last, void* _Dest) noexcept {
+    if (_First == _Last) {
+        return _Dest;
+    }
+
+    memcpy(_Dest, _First, 8);
+    _Advance_bytes(_First, 8);
+
+#ifndef _M_ARM64EC
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx_8>(_First, _Stop, _Dest);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_sse42() && _Size_bytes >= 16) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_8>(_First, _Stop, _Dest);
+        _First = _Stop;
+    }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+    return _Removing::_Unique_fallback<uint64_t>(_First, _Last, _Dest);
+}
+
+} // extern "C"
+
+namespace {
+    namespace _Bitset_to_string {
+#ifdef _M_ARM64EC
+        using _Traits_1_avx = void;
+        using _Traits_1_sse = void;
+        using _Traits_2_avx = void;
+        using _Traits_2_sse = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        struct _Traits_avx {
+            static void _Out(void* const _Dest, const __m256i _Elems) noexcept {
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Elems);
+            }
+
+            static void _Exit_vectorized() noexcept {
+                _mm256_zeroupper();
+            }
+        };
+
+        struct _Traits_sse {
+            static void _Out(void* const _Dest, const __m128i _Elems) noexcept {
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Elems);
+            }
+
+            static void _Exit_vectorized() noexcept {}
+        };
+
+        struct _Traits_1_avx : _Traits_avx {
+            using _Value_type = uint32_t;
+
+            static __m256i _Set(const char _Val) noexcept {
+                return _mm256_broadcastb_epi8(_mm_cvtsi32_si128(_Val));
+            }
+
+            static __m256i __forceinline _Step(const uint32_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
+                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
+                const __m128i _Vx1 =
+                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x01010101, 0x02020202, 0x03030303));
+                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
+                const __m256i _Vx3 = _mm256_permutevar8x32_epi32(_Vx2, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+                const __m256i _Msk = _mm256_and_si256(_Vx3, _mm256_set1_epi64x(0x0102040810204080));
+                const __m256i _Ex0 = _mm256_cmpeq_epi8(_Msk, _mm256_setzero_si256());
+                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+        };
+
+        struct _Traits_1_sse : _Traits_sse {
+            using _Value_type = uint16_t;
+
+            static __m128i _Set(const char _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static __m128i __forceinline _Step(const uint16_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
+                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
+                const __m128i _Vx1 =
+                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
+                const __m128i _Msk = _mm_and_si128(_Vx1, _mm_set1_epi64x(0x0102040810204080));
+                const __m128i _Ex0 = _mm_cmpeq_epi8(_Msk, _mm_setzero_si128());
+                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+        };
+
+        struct _Traits_2_avx : _Traits_avx {
+            using _Value_type = uint16_t;
+
+            static __m256i _Set(const wchar_t _Val) noexcept {
+                return _mm256_broadcastw_epi16(_mm_cvtsi32_si128(_Val));
+            }
+
+            static __m256i __forceinline _Step(const uint16_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
+                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
+                const __m128i _Vx1 =
+                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
+                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
+                const __m256i _Vx3 = _mm256_permute4x64_epi64(_Vx2, _MM_SHUFFLE(1, 1, 0, 0));
+                const __m256i _Msk = _mm256_and_si256(_Vx3,
+                    _mm256_set_epi64x(0x0001000200040008, 0x0010002000400080, 0x0001000200040008, 0x0010002000400080));
+                const __m256i _Ex0 = _mm256_cmpeq_epi16(_Msk, _mm256_setzero_si256());
+                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+        };
+
+        struct _Traits_2_sse : _Traits_sse {
+            using _Value_type = uint8_t;
+
+            static __m128i _Set(const wchar_t _Val) noexcept {
+                return _mm_set1_epi16(_Val);
+            }
+
+            static __m128i __forceinline _Step(const uint8_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
+                const __m128i _Vx  = _mm_set1_epi16(_Val);
+                const __m128i _Msk = _mm_and_si128(_Vx, _mm_set_epi64x(0x0001000200040008, 0x0010002000400080));
+                const __m128i _Ex0 = _mm_cmpeq_epi16(_Msk, _mm_setzero_si128());
+                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
+                return _Ex1;
+            }
+        };
+
+        template <class _Traits, class _Elem>
+        void __stdcall _Impl(
+            _Elem* const _Dest, const void* _Src, size_t _Size_bits, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+            constexpr size_t _Step_size_bits = sizeof(typename _Traits::_Value_type) * 8;
+
+            const auto _Px0 = _Traits::_Set(_Elem0);
+            const auto _Px1 = _Traits::_Set(_Elem1);
+            if (_Size_bits >= _Step_size_bits) {
+                _Elem* _Pos = _Dest + _Size_bits;
+                _Size_bits &= _Step_size_bits - 1;
+                _Elem* const _Stop_at = _Dest + _Size_bits;
+                do {
+                    typename _Traits::_Value_type _Val;
+                    memcpy(&_Val, _Src, sizeof(_Val));
+                    const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
+                    _Pos -= _Step_size_bits;
+                    _Traits::_Out(_Pos, _Elems);
+                    _Advance_bytes(_Src, sizeof(_Val));
+                } while (_Pos != _Stop_at);
+            }
+
+            if (_Size_bits > 0) {
+                typename _Traits::_Value_type _Val;
+                memcpy(&_Val, _Src, sizeof(_Val));
+                const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
+                _Elem _Tmp[_Step_size_bits];
+                _Traits::_Out(_Tmp, _Elems);
+                const _Elem* const _Tmpd = _Tmp + (_Step_size_bits - _Size_bits);
+                memcpy(_Dest, _Tmpd, _Size_bits * sizeof(_Elem));
+            }
+
+            _Traits::_Exit_vectorized(); // TRANSITION, DevCom-10331414
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Avx_traits, class _Sse_traits, class _Elem>
+        void __stdcall _Dispatch(_Elem* const _Dest, const void* const _Src, const size_t _Size_bits,
+            const _Elem _Elem0, const _Elem _Elem1) noexcept {
+#ifndef _M_ARM64EC
+            if (_Use_avx2() && _Size_bits >= 256) {
+                _Impl<_Avx_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+            } else if (_Use_sse42()) {
+                _Impl<_Sse_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+            } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            {
+                const auto _Arr = reinterpret_cast<const uint8_t*>(_Src);
+                for (size_t _Ix = 0; _Ix < _Size_bits; ++_Ix) {
+                    _Dest[_Size_bits - 1 - _Ix] = ((_Arr[_Ix >> 3] >> (_Ix & 7)) & 1) != 0 ? _Elem1 : _Elem0;
+                }
+            }
+        }
+    } // namespace _Bitset_to_string
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_bitset_to_string_1(
+    char* const _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
+    using namespace _Bitset_to_string;
+    _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) void __stdcall __std_bitset_to_string_2(wchar_t* const _Dest, const void* const _Src,
+    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
+    using namespace _Bitset_to_string;
+    _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+}
+
+} // extern "C"
+
+namespace {
+    namespace _Bitset_from_string {
+#ifdef _M_ARM64EC
+        using _Traits_1_avx = void;
+        using _Traits_1_sse = void;
+        using _Traits_2_avx = void;
+        using _Traits_2_sse = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        struct _Traits_avx {
+            using _Guard = _Zeroupper_on_exit;
+            using _Vec   = __m256i;
+
+            static __m256i _Load(const void* _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static void _Store(void* _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            }
+
+            static bool _Check(const __m256i _Val, const __m256i _Ex1, const __m256i _Dx0) noexcept {
+                return _mm256_testc_si256(_Ex1, _mm256_xor_si256(_Val, _Dx0));
+            }
+        };
+
+        struct _Traits_sse {
+            using _Guard = char;
+            using _Vec   = __m128i;
+
+            static __m128i _Load(const void* _Src) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            }
+
+            static void _Store(void* _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+            }
+
+            static bool _Check(const __m128i _Val, const __m128i _Ex1, const __m128i _Dx0) noexcept {
+                return _mm_testc_si128(_Ex1, _mm_xor_si128(_Val, _Dx0));
+            }
+        };
+
+        struct _Traits_1_avx : _Traits_avx {
+            static __m256i _Set(const char _Val) noexcept {
+                return _mm256_set1_epi8(_Val);
+            }
+
+            static uint32_t _To_bits(const __m256i _Ex1) noexcept {
+                const __m256i _Shuf = _mm256_set_epi8( //
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
+                return _rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 16);
+            }
+
+            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
+                return _mm256_cmpeq_epi8(_Val, _Dx1);
+            }
+        };
+
+        struct _Traits_1_sse : _Traits_sse {
+            static __m128i _Set(const char _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static uint16_t _To_bits(const __m128i _Ex1) noexcept {
+                const __m128i _Shuf = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
+                return static_cast<uint16_t>(_mm_movemask_epi8(_Ex2));
+            }
+
+            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
+                return _mm_cmpeq_epi8(_Val, _Dx1);
+            }
+        };
+
+        struct _Traits_2_avx : _Traits_avx {
+            static __m256i _Set(const wchar_t _Val) noexcept {
+                return _mm256_set1_epi16(_Val);
+            }
+
+            static uint16_t _To_bits(const __m256i _Ex1) noexcept {
+                const __m256i _Shuf = _mm256_set_epi8( //
+                    +0, +2, +4, +6, +8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1, //
+                    -1, -1, -1, -1, -1, -1, -1, -1, +0, +2, +4, +6, +8, 10, 12, 14);
+
+                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
+                return static_cast<uint16_t>(_rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 8));
+            }
+
+            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
+                return _mm256_cmpeq_epi16(_Val, _Dx1);
+            }
+        };
+
+        struct _Traits_2_sse : _Traits_sse {
+            static __m128i _Set(const wchar_t _Val) noexcept {
+                return _mm_set1_epi16(_Val);
+            }
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+            static uint8_t _To_bits(const __m128i _Ex1) noexcept {
+                const __m128i _Shuf = _mm_set_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 4, 6, 8, 10, 12, 14);
+                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
+                return static_cast<uint8_t>(_mm_movemask_epi8(_Ex2));
+            }
 
-void* __stdcall __std_remove_copy_8(
-    const void* _First, const void* const _Last, void* _Out, const uint64_t _Val) noexcept {
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx_8>(_First, _Stop, _Out, _Val);
-        _First = _Stop;
+            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
+                return _mm_cmpeq_epi16(_Val, _Dx1);
+            }
+        };
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Out   = _Removing::_Remove_copy_impl<_Removing::_Sse_8>(_First, _Stop, _Out, _Val);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        template <class _Traits, class _Elem, class _OutFn>
+        bool _Loop(const _Elem* const _Src, const _Elem* _Src_end, const typename _Traits::_Vec _Dx0,
+            const typename _Traits::_Vec _Dx1, _OutFn _Out) noexcept {
+            for (;;) {
+                typename _Traits::_Vec _Val;
+                constexpr size_t _Per_vec = sizeof(_Val) / sizeof(_Elem);
 
-    return _Removing::_Remove_fallback(_First, _Last, _Out, _Val);
-}
+                if (const size_t _Left = _Src_end - _Src; _Left >= _Per_vec) {
+                    _Src_end -= _Per_vec;
+                    _Val = _Traits::_Load(_Src_end);
+                } else if (_Left == 0) {
+                    return true;
+                } else {
+                    _Src_end = _Src;
+                    _Elem _Tmp[_Per_vec];
+                    _Traits::_Store(_Tmp, _Dx0);
+                    _Elem* const _Tmpd = _Tmp + (_Per_vec - _Left);
+                    memcpy(_Tmpd, _Src_end, _Left * sizeof(_Elem));
+                    _Val = _Traits::_Load(_Tmp);
+                }
 
-void* __stdcall __std_unique_1(void* _First, void* const _Last) noexcept {
-    _First = const_cast<void*>(__std_adjacent_find_1(_First, _Last));
+                const auto _Ex1 = _Traits::_Cmp(_Val, _Dx1);
 
-    if (_First == _Last) {
-        return _First;
-    }
+                if (!_Traits::_Check(_Val, _Ex1, _Dx0)) {
+                    return false;
+                }
 
-    void* _Dest = _First;
-    _Advance_bytes(_First, 1);
+                _Out(_Ex1);
+            }
+        }
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
-        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_1>(_First, _Stop);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        template <class _Traits, class _Elem>
+        bool _Impl(void* _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
+            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            const auto _Dx0 = _Traits::_Set(_Elem0);
+            const auto _Dx1 = _Traits::_Set(_Elem1);
 
-    return _Removing::_Unique_fallback<uint8_t>(_First, _Last, _Dest);
-}
+            void* _Dest_end = _Dest;
+            _Advance_bytes(_Dest_end, _Size_bytes);
 
-void* __stdcall __std_unique_2(void* _First, void* const _Last) noexcept {
-    _First = const_cast<void*>(__std_adjacent_find_2(_First, _Last));
+            auto _Out = [&_Dest](const _Traits::_Vec _Ex1) {
+                const auto _Val = _Traits::_To_bits(_Ex1);
+                memcpy(_Dest, &_Val, sizeof(_Val));
+                _Advance_bytes(_Dest, sizeof(_Val));
+            };
 
-    if (_First == _Last) {
-        return _First;
-    }
+            const size_t _Size_convert = (_Size_chars <= _Size_bits) ? _Size_chars : _Size_bits;
 
-    void* _Dest = _First;
-    _Advance_bytes(_First, 2);
+            // Convert characters to bits
+            if (!_Loop<_Traits>(_Src, _Src + _Size_convert, _Dx0, _Dx1, _Out)) {
+                return false;
+            }
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_2>(_First, _Stop);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            // Verify remaining characters, if any
+            if (_Size_convert != _Size_chars
+                && !_Loop<_Traits>(_Src + _Size_convert, _Src + _Size_chars, _Dx0, _Dx1, [](_Traits::_Vec) {})) {
+                return false;
+            }
 
-    return _Removing::_Unique_fallback<uint16_t>(_First, _Last, _Dest);
-}
+            // Trim tail (may be padding tail, or too short string, or both)
+            if (_Dest != _Dest_end) {
+                memset(_Dest, 0, _Byte_length(_Dest, _Dest_end));
+            }
 
-void* __stdcall __std_unique_4(void* _First, void* const _Last) noexcept {
-    _First = const_cast<void*>(__std_adjacent_find_4(_First, _Last));
+            return true;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
 
-    if (_First == _Last) {
-        return _First;
-    }
+        template <class _Elem>
+        bool _Fallback(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
+            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+            const auto _Dest_bytes = static_cast<uint8_t*>(_Dest);
+            size_t _Size_convert   = _Size_chars;
 
-    void* _Dest = _First;
-    _Advance_bytes(_First, 4);
+            if (_Size_chars > _Size_bits) {
+                _Size_convert = _Size_bits;
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Dest  = _Removing::_Unique_impl<_Removing::_Avx_4>(_First, _Stop);
-        _First = _Stop;
+                for (size_t _Ix = _Size_bits; _Ix < _Size_chars; ++_Ix) {
+                    if (const _Elem _Cur = _Src[_Ix]; _Cur != _Elem0 && _Cur != _Elem1) {
+                        return false;
+                    }
+                }
+            }
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_4>(_First, _Stop);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            memset(_Dest, 0, _Size_bytes);
 
-    return _Removing::_Unique_fallback<uint32_t>(_First, _Last, _Dest);
-}
+            for (size_t _Ix = 0; _Ix != _Size_convert; ++_Ix) {
+                const _Elem _Cur = _Src[_Size_convert - _Ix - 1];
 
-void* __stdcall __std_unique_8(void* _First, void* const _Last) noexcept {
-    _First = const_cast<void*>(__std_adjacent_find_8(_First, _Last));
+                if (_Cur != _Elem0 && _Cur != _Elem1) {
+                    return false;
+                }
 
-    if (_First == _Last) {
-        return _First;
-    }
+                _Dest_bytes[_Ix >> 3] |= static_cast<uint8_t>(_Cur == _Elem1) << (_Ix & 0x7);
+            }
 
-    void* _Dest = _First;
-    _Advance_bytes(_First, 8);
+            return true;
+        }
 
+        template <class _Avx, class _Sse, class _Elem>
+        bool _Dispatch(void* _Dest, const _Elem* _Src, size_t _Size_bytes, size_t _Size_bits, size_t _Size_chars,
+            _Elem _Elem0, _Elem _Elem1) noexcept {
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Dest  = _Removing::_Unique_impl<_Removing::_Avx_8>(_First, _Stop);
-        _First = _Stop;
-
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Dest  = _Removing::_Unique_impl<_Removing::_Sse_8>(_First, _Stop);
-        _First = _Stop;
-    }
+            if (_Use_avx2() && _Size_bits >= 256) {
+                return _Impl<_Avx>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            } else if (_Use_sse42()) {
+                return _Impl<_Sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            } else
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
+            {
+                return _Fallback(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            }
+        }
+    } // namespace _Bitset_from_string
+} // unnamed namespace
 
-    return _Removing::_Unique_fallback<uint64_t>(_First, _Last, _Dest);
-}
+extern "C" {
 
-void* __stdcall __std_unique_copy_1(const void* _First, const void* const _Last, void* _Dest) noexcept {
-    if (_First == _Last) {
-        return _Dest;
-    }
+__declspec(noalias) bool __stdcall __std_bitset_from_string_1(void* const _Dest, const char* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const char _Elem0,
+    const char _Elem1) noexcept {
+    using namespace _Bitset_from_string;
 
-    memcpy(_Dest, _First, 1);
-    _Advance_bytes(_First, 1);
+    return _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 8) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{7});
-        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_1>(_First, _Stop, _Dest);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+__declspec(noalias) bool __stdcall __std_bitset_from_string_2(void* const _Dest, const wchar_t* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const wchar_t _Elem0,
+    const wchar_t _Elem1) noexcept {
+    using namespace _Bitset_from_string;
 
-    return _Removing::_Unique_fallback<uint8_t>(_First, _Last, _Dest);
+    return _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
 }
 
-void* __stdcall __std_unique_copy_2(const void* _First, const void* const _Last, void* _Dest) noexcept {
-    if (_First == _Last) {
-        return _Dest;
-    }
+} // extern "C"
 
-    memcpy(_Dest, _First, 2);
-    _Advance_bytes(_First, 2);
+namespace {
+    namespace _Bitset_words {
+        // These work on the arrays of 64-bit words of large bitsets, whose padding bits are zero.
+
+        size_t _Popcount_fallback(uint64_t _Val) noexcept {
+            _Val -= (_Val >> 1) & 0x5555'5555'5555'5555;
+            _Val = (_Val & 0x3333'3333'3333'3333) + ((_Val >> 2) & 0x3333'3333'3333'3333);
+            _Val = (_Val + (_Val >> 4)) & 0x0F0F'0F0F'0F0F'0F0F;
+            return static_cast<size_t>((_Val * 0x0101'0101'0101'0101) >> 56);
+        }
 
-#ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_sse42() && _Size_bytes >= 16) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_2>(_First, _Stop, _Dest);
-        _First = _Stop;
-    }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        void _Shift_left_scalar(
+            uint64_t* const _Array, size_t _Ix, const size_t _Word_shift, const size_t _Bit_shift) noexcept {
+            // shift the words below _Ix, see _Shift_left_impl
+            for (; _Ix > _Word_shift; --_Ix) {
+                uint64_t _Val = _Array[_Ix - 1 - _Word_shift] << _Bit_shift;
+                if (_Bit_shift != 0 && _Ix - 1 > _Word_shift) {
+                    _Val |= _Array[_Ix - 2 - _Word_shift] >> (64 - _Bit_shift);
+                }
 
-    return _Removing::_Unique_fallback<uint16_t>(_First, _Last, _Dest);
-}
+                _Array[_Ix - 1] = _Val;
+            }
+
+            memset(_Array, 0, _Ix * sizeof(uint64_t));
+        }
+
+        void _Shift_right_scalar(uint64_t* const _Array, size_t _Ix, const size_t _Size_words,
+            const size_t _Word_shift, const size_t _Bit_shift) noexcept {
+            // shift the words from _Ix on, see _Shift_right_impl
+            for (; _Ix + _Word_shift < _Size_words; ++_Ix) {
+                uint64_t _Val = _Array[_Ix + _Word_shift] >> _Bit_shift;
+                if (_Bit_shift != 0 && _Ix + _Word_shift + 1 < _Size_words) {
+                    _Val |= _Array[_Ix + _Word_shift + 1] << (64 - _Bit_shift);
+                }
 
-void* __stdcall __std_unique_copy_4(const void* _First, const void* const _Last, void* _Dest) noexcept {
-    if (_First == _Last) {
-        return _Dest;
-    }
+                _Array[_Ix] = _Val;
+            }
 
-    memcpy(_Dest, _First, 4);
-    _Advance_bytes(_First, 4);
+            if (_Ix < _Size_words) {
+                memset(_Array + _Ix, 0, (_Size_words - _Ix) * sizeof(uint64_t));
+            }
+        }
+
+        struct _And {
+            static uint64_t _Apply(const uint64_t _Left, const uint64_t _Right) noexcept {
+                return _Left & _Right;
+            }
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx_4>(_First, _Stop, _Dest);
-        _First = _Stop;
+            static __m256i _Apply(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_and_si256(_Left, _Right);
+            }
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_4>(_First, _Stop, _Dest);
-        _First = _Stop;
-    }
+            static __m128i _Apply(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_and_si128(_Left, _Right);
+            }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
+        };
 
-    return _Removing::_Unique_fallback<uint32_t>(_First, _Last, _Dest);
-}
+        struct _Or {
+            static uint64_t _Apply(const uint64_t _Left, const uint64_t _Right) noexcept {
+                return _Left | _Right;
+            }
 
-void* __stdcall __std_unique_copy_8(const void* _First, const void* const _Last, void* _Dest) noexcept {
-    if (_First == _Last) {
-        return _Dest;
-    }
+#ifndef _M_ARM64EC
+            static __m256i _Apply(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_or_si256(_Left, _Right);
+            }
 
-    memcpy(_Dest, _First, 8);
-    _Advance_bytes(_First, 8);
+            static __m128i _Apply(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_or_si128(_Left, _Right);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        };
+
+        struct _Xor {
+            static uint64_t _Apply(const uint64_t _Left, const uint64_t _Right) noexcept {
+                return _Left ^ _Right;
+            }
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
-        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx_8>(_First, _Stop, _Dest);
-        _First = _Stop;
+            static __m256i _Apply(const __m256i _Left, const __m256i _Right) noexcept {
+                return _mm256_xor_si256(_Left, _Right);
+            }
 
-        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
-    } else if (_Use_sse42() && _Size_bytes >= 16) {
-        const void* _Stop = _First;
-        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0xF});
-        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Sse_8>(_First, _Stop, _Dest);
-        _First = _Stop;
-    }
+            static __m128i _Apply(const __m128i _Left, const __m128i _Right) noexcept {
+                return _mm_xor_si128(_Left, _Right);
+            }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
+        };
 
-    return _Removing::_Unique_fallback<uint64_t>(_First, _Last, _Dest);
-}
+#ifndef _M_ARM64EC
+        struct _Traits_avx {
+            using _Guard = _Zeroupper_on_exit;
 
-} // extern "C"
+            static constexpr size_t _Words_per_vec = 4;
 
-namespace {
-    namespace _Bitset_to_string {
-#ifdef _M_ARM64EC
-        using _Traits_1_avx = void;
-        using _Traits_1_sse = void;
-        using _Traits_2_avx = void;
-        using _Traits_2_sse = void;
-#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
-        struct _Traits_avx {
-            static void _Out(void* const _Dest, const __m256i _Elems) noexcept {
-                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Elems);
+            static __m256i _Load(const uint64_t* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
             }
 
-            static void _Exit_vectorized() noexcept {
-                _mm256_zeroupper();
+            static void _Store(uint64_t* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            }
+
+            static __m256i _Shift_left(const __m256i _Val, const __m128i _Count) noexcept {
+                return _mm256_sll_epi64(_Val, _Count);
+            }
+
+            static __m256i _Shift_right(const __m256i _Val, const __m128i _Count) noexcept {
+                return _mm256_srl_epi64(_Val, _Count);
+            }
+
+            static bool _All_zeros(const __m256i _Val) noexcept {
+                return _mm256_testz_si256(_Val, _Val) != 0;
+            }
+
+            static bool _All_ones(const __m256i _Val) noexcept {
+                return _mm256_testc_si256(_Val, _mm256_set1_epi32(-1)) != 0;
             }
         };
 
         struct _Traits_sse {
-            static void _Out(void* const _Dest, const __m128i _Elems) noexcept {
-                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Elems);
+            using _Guard = char;
+
+            static constexpr size_t _Words_per_vec = 2;
+
+            static __m128i _Load(const uint64_t* const _Src) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
             }
 
-            static void _Exit_vectorized() noexcept {}
-        };
+            static void _Store(uint64_t* const _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+            }
 
-        struct _Traits_1_avx : _Traits_avx {
-            using _Value_type = uint32_t;
+            static __m128i _Shift_left(const __m128i _Val, const __m128i _Count) noexcept {
+                return _mm_sll_epi64(_Val, _Count);
+            }
 
-            static __m256i _Set(const char _Val) noexcept {
-                return _mm256_broadcastb_epi8(_mm_cvtsi32_si128(_Val));
+            static __m128i _Shift_right(const __m128i _Val, const __m128i _Count) noexcept {
+                return _mm_srl_epi64(_Val, _Count);
             }
 
-            static __m256i __forceinline _Step(const uint32_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
-                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
-                const __m128i _Vx1 =
-                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x01010101, 0x02020202, 0x03030303));
-                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
-                const __m256i _Vx3 = _mm256_permutevar8x32_epi32(_Vx2, _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0));
-                const __m256i _Msk = _mm256_and_si256(_Vx3, _mm256_set1_epi64x(0x0102040810204080));
-                const __m256i _Ex0 = _mm256_cmpeq_epi8(_Msk, _mm256_setzero_si256());
-                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
+            static bool _All_zeros(const __m128i _Val) noexcept {
+                return _mm_testz_si128(_Val, _Val) != 0;
+            }
+
+            static bool _All_ones(const __m128i _Val) noexcept {
+                return _mm_testc_si128(_Val, _mm_set1_epi32(-1)) != 0;
             }
         };
 
-        struct _Traits_1_sse : _Traits_sse {
-            using _Value_type = uint16_t;
+        template <class _Traits, class _Op>
+        void _Bitwise_impl(uint64_t* const _Dest, const uint64_t* const _Src, const size_t _Size_words) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            size_t _Ix = 0;
+            for (; _Ix + _Traits::_Words_per_vec <= _Size_words; _Ix += _Traits::_Words_per_vec) {
+                _Traits::_Store(_Dest + _Ix, _Op::_Apply(_Traits::_Load(_Dest + _Ix), _Traits::_Load(_Src + _Ix)));
+            }
 
-            static __m128i _Set(const char _Val) noexcept {
-                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            for (; _Ix != _Size_words; ++_Ix) {
+                _Dest[_Ix] = _Op::_Apply(_Dest[_Ix], _Src[_Ix]);
             }
+        }
 
-            static __m128i __forceinline _Step(const uint16_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
-                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
-                const __m128i _Vx1 =
-                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
-                const __m128i _Msk = _mm_and_si128(_Vx1, _mm_set1_epi64x(0x0102040810204080));
-                const __m128i _Ex0 = _mm_cmpeq_epi8(_Msk, _mm_setzero_si128());
-                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
+        template <class _Traits>
+        bool _Any_impl(const uint64_t* const _Src, const size_t _Size_words) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            size_t _Ix = 0;
+            for (; _Ix + _Traits::_Words_per_vec <= _Size_words; _Ix += _Traits::_Words_per_vec) {
+                if (!_Traits::_All_zeros(_Traits::_Load(_Src + _Ix))) {
+                    return true;
+                }
             }
-        };
 
-        struct _Traits_2_avx : _Traits_avx {
-            using _Value_type = uint16_t;
+            for (; _Ix != _Size_words; ++_Ix) {
+                if (_Src[_Ix] != 0) {
+                    return true;
+                }
+            }
 
-            static __m256i _Set(const wchar_t _Val) noexcept {
-                return _mm256_broadcastw_epi16(_mm_cvtsi32_si128(_Val));
+            return false;
+        }
+
+        template <class _Traits>
+        bool _All_impl(const uint64_t* const _Src, const size_t _Size_bits) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            const size_t _Full_words = _Size_bits / 64;
+            size_t _Ix               = 0;
+            for (; _Ix + _Traits::_Words_per_vec <= _Full_words; _Ix += _Traits::_Words_per_vec) {
+                if (!_Traits::_All_ones(_Traits::_Load(_Src + _Ix))) {
+                    return false;
+                }
             }
 
-            static __m256i __forceinline _Step(const uint16_t _Val, const __m256i _Px0, const __m256i _Px1) noexcept {
-                const __m128i _Vx0 = _mm_cvtsi32_si128(_Val);
-                const __m128i _Vx1 =
-                    _mm_shuffle_epi8(_Vx0, _mm_set_epi32(0x00000000, 0x00000000, 0x01010101, 0x01010101));
-                const __m256i _Vx2 = _mm256_castsi128_si256(_Vx1);
-                const __m256i _Vx3 = _mm256_permute4x64_epi64(_Vx2, _MM_SHUFFLE(1, 1, 0, 0));
-                const __m256i _Msk = _mm256_and_si256(_Vx3,
-                    _mm256_set_epi64x(0x0001000200040008, 0x0010002000400080, 0x0001000200040008, 0x0010002000400080));
-                const __m256i _Ex0 = _mm256_cmpeq_epi16(_Msk, _mm256_setzero_si256());
-                const __m256i _Ex1 = _mm256_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
+            for (; _Ix != _Full_words; ++_Ix) {
+                if (_Src[_Ix] != ~uint64_t{0}) {
+                    return false;
+                }
             }
-        };
 
-        struct _Traits_2_sse : _Traits_sse {
-            using _Value_type = uint8_t;
+            const size_t _Tail_bits = _Size_bits % 64;
+            return _Tail_bits == 0 || _Src[_Full_words] == (uint64_t{1} << _Tail_bits) - 1;
+        }
 
-            static __m128i _Set(const wchar_t _Val) noexcept {
-                return _mm_set1_epi16(_Val);
+        // The vector shifts produce zero for counts of 64, so a _Bit_shift of zero needs no special case there.
+
+        template <class _Traits>
+        void _Shift_left_impl(uint64_t* const _Array, const size_t _Size_words, const size_t _Word_shift,
+            const size_t _Bit_shift) noexcept {
+            // _Array[_Ix] becomes the bits from _Array[_Ix - _Word_shift] and _Array[_Ix - _Word_shift - 1];
+            // going down reads each word before it is overwritten
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            const __m128i _Count_left  = _mm_cvtsi32_si128(static_cast<int>(_Bit_shift));
+            const __m128i _Count_right = _mm_cvtsi32_si128(static_cast<int>(64 - _Bit_shift));
+
+            size_t _Ix = _Size_words; // one past the next word to be written
+            while (_Ix >= _Word_shift + 1 + _Traits::_Words_per_vec) {
+                _Ix -= _Traits::_Words_per_vec;
+                const auto _High = _Traits::_Load(_Array + (_Ix - _Word_shift));
+                const auto _Low  = _Traits::_Load(_Array + (_Ix - _Word_shift - 1));
+                _Traits::_Store(_Array + _Ix,
+                    _Or::_Apply(_Traits::_Shift_left(_High, _Count_left), _Traits::_Shift_right(_Low, _Count_right)));
             }
 
-            static __m128i __forceinline _Step(const uint8_t _Val, const __m128i _Px0, const __m128i _Px1) noexcept {
-                const __m128i _Vx  = _mm_set1_epi16(_Val);
-                const __m128i _Msk = _mm_and_si128(_Vx, _mm_set_epi64x(0x0001000200040008, 0x0010002000400080));
-                const __m128i _Ex0 = _mm_cmpeq_epi16(_Msk, _mm_setzero_si128());
-                const __m128i _Ex1 = _mm_blendv_epi8(_Px1, _Px0, _Ex0);
-                return _Ex1;
+            _Shift_left_scalar(_Array, _Ix, _Word_shift, _Bit_shift);
+        }
+
+        template <class _Traits>
+        void _Shift_right_impl(uint64_t* const _Array, const size_t _Size_words, const size_t _Word_shift,
+            const size_t _Bit_shift) noexcept {
+            // _Array[_Ix] becomes the bits from _Array[_Ix + _Word_shift] and _Array[_Ix + _Word_shift + 1];
+            // going up reads each word before it is overwritten
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            const __m128i _Count_right = _mm_cvtsi32_si128(static_cast<int>(_Bit_shift));
+            const __m128i _Count_left  = _mm_cvtsi32_si128(static_cast<int>(64 - _Bit_shift));
+
+            size_t _Ix = 0;
+            for (; _Ix + _Word_shift + 1 + _Traits::_Words_per_vec <= _Size_words; _Ix += _Traits::_Words_per_vec) {
+                const auto _Low  = _Traits::_Load(_Array + (_Ix + _Word_shift));
+                const auto _High = _Traits::_Load(_Array + (_Ix + _Word_shift + 1));
+                _Traits::_Store(_Array + _Ix,
+                    _Or::_Apply(_Traits::_Shift_right(_Low, _Count_right), _Traits::_Shift_left(_High, _Count_left)));
             }
-        };
 
-        template <class _Traits, class _Elem>
-        void __stdcall _Impl(
-            _Elem* const _Dest, const void* _Src, size_t _Size_bits, const _Elem _Elem0, const _Elem _Elem1) noexcept {
-            constexpr size_t _Step_size_bits = sizeof(typename _Traits::_Value_type) * 8;
+            _Shift_right_scalar(_Array, _Ix, _Size_words, _Word_shift, _Bit_shift);
+        }
 
-            const auto _Px0 = _Traits::_Set(_Elem0);
-            const auto _Px1 = _Traits::_Set(_Elem1);
-            if (_Size_bits >= _Step_size_bits) {
-                _Elem* _Pos = _Dest + _Size_bits;
-                _Size_bits &= _Step_size_bits - 1;
-                _Elem* const _Stop_at = _Dest + _Size_bits;
-                do {
-                    typename _Traits::_Value_type _Val;
-                    memcpy(&_Val, _Src, sizeof(_Val));
-                    const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
-                    _Pos -= _Step_size_bits;
-                    _Traits::_Out(_Pos, _Elems);
-                    _Advance_bytes(_Src, sizeof(_Val));
-                } while (_Pos != _Stop_at);
+        size_t _Popcount_popcnt(const uint64_t _Val) noexcept { // Assume available with SSE4.2
+#ifdef _M_IX86
+            return __popcnt(static_cast<uint32_t>(_Val)) + __popcnt(static_cast<uint32_t>(_Val >> 32));
+#else // ^^^ defined(_M_IX86) / !defined(_M_IX86) vvv
+            return static_cast<size_t>(__popcnt64(_Val));
+#endif // ^^^ !defined(_M_IX86) ^^^
+        }
+
+        size_t _Count_avx2(const uint64_t* const _Src, const size_t _Size_words) noexcept {
+            // count the bits of each nibble with a table lookup, then sum the bytes (Mula, Kurz, and Lemire,
+            // "Faster Population Counts Using AVX2 Instructions")
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+            const __m256i _Nibble_counts = _mm256_setr_epi8(
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i _Low_nibbles = _mm256_set1_epi8(0x0F);
+
+            __m256i _Sums = _mm256_setzero_si256();
+            size_t _Ix    = 0;
+            for (; _Ix + 4 <= _Size_words; _Ix += 4) {
+                const __m256i _Val    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Ix));
+                const __m256i _Low    = _mm256_and_si256(_Val, _Low_nibbles);
+                const __m256i _High   = _mm256_and_si256(_mm256_srli_epi16(_Val, 4), _Low_nibbles);
+                const __m256i _Counts = _mm256_add_epi8(
+                    _mm256_shuffle_epi8(_Nibble_counts, _Low), _mm256_shuffle_epi8(_Nibble_counts, _High));
+                _Sums = _mm256_add_epi64(_Sums, _mm256_sad_epu8(_Counts, _mm256_setzero_si256()));
             }
 
-            if (_Size_bits > 0) {
-                typename _Traits::_Value_type _Val;
-                memcpy(&_Val, _Src, sizeof(_Val));
-                const auto _Elems = _Traits::_Step(_Val, _Px0, _Px1);
-                _Elem _Tmp[_Step_size_bits];
-                _Traits::_Out(_Tmp, _Elems);
-                const _Elem* const _Tmpd = _Tmp + (_Step_size_bits - _Size_bits);
-                memcpy(_Dest, _Tmpd, _Size_bits * sizeof(_Elem));
+            uint64_t _Lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Lanes), _Sums);
+            size_t _Result = static_cast<size_t>(_Lanes[0] + _Lanes[1] + _Lanes[2] + _Lanes[3]);
+            for (; _Ix != _Size_words; ++_Ix) {
+                _Result += _Popcount_popcnt(_Src[_Ix]);
+            }
+
+            return _Result;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Op>
+        void _Bitwise(void* const _Dest, const void* const _Src, const size_t _Size_words) noexcept {
+            const auto _Dest_words = static_cast<uint64_t*>(_Dest);
+            const auto _Src_words  = static_cast<const uint64_t*>(_Src);
+#ifndef _M_ARM64EC
+            if (_Use_avx2()) {
+                _Bitwise_impl<_Traits_avx, _Op>(_Dest_words, _Src_words, _Size_words);
+            } else if (_Use_sse42()) {
+                _Bitwise_impl<_Traits_sse, _Op>(_Dest_words, _Src_words, _Size_words);
+            } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            {
+                for (size_t _Ix = 0; _Ix != _Size_words; ++_Ix) {
+                    _Dest_words[_Ix] = _Op::_Apply(_Dest_words[_Ix], _Src_words[_Ix]);
+                }
+            }
+        }
+    } // namespace _Bitset_words
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_bitset_and(
+    void* const _Dest, const void* const _Src, const size_t _Size_words) noexcept {
+    _Bitset_words::_Bitwise<_Bitset_words::_And>(_Dest, _Src, _Size_words);
+}
+
+__declspec(noalias) void __stdcall __std_bitset_or(
+    void* const _Dest, const void* const _Src, const size_t _Size_words) noexcept {
+    _Bitset_words::_Bitwise<_Bitset_words::_Or>(_Dest, _Src, _Size_words);
+}
+
+__declspec(noalias) void __stdcall __std_bitset_xor(
+    void* const _Dest, const void* const _Src, const size_t _Size_words) noexcept {
+    _Bitset_words::_Bitwise<_Bitset_words::_Xor>(_Dest, _Src, _Size_words);
+}
+
+__declspec(noalias) size_t __stdcall __std_bitset_count(const void* const _Src, const size_t _Size_words) noexcept {
+    using namespace _Bitset_words;
+
+    const auto _Src_words = static_cast<const uint64_t*>(_Src);
+    size_t _Result        = 0;
+#ifndef _M_ARM64EC
+    if (_Use_avx2()) {
+        return _Count_avx2(_Src_words, _Size_words);
+    } else if (_Use_sse42()) {
+        for (size_t _Ix = 0; _Ix != _Size_words; ++_Ix) {
+            _Result += _Popcount_popcnt(_Src_words[_Ix]);
+        }
+    } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+    {
+        for (size_t _Ix = 0; _Ix != _Size_words; ++_Ix) {
+            _Result += _Popcount_fallback(_Src_words[_Ix]);
+        }
+    }
+
+    return _Result;
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_any(const void* const _Src, const size_t _Size_words) noexcept {
+    using namespace _Bitset_words;
+
+    const auto _Src_words = static_cast<const uint64_t*>(_Src);
+#ifndef _M_ARM64EC
+    if (_Use_avx2()) {
+        return _Any_impl<_Traits_avx>(_Src_words, _Size_words);
+    } else if (_Use_sse42()) {
+        return _Any_impl<_Traits_sse>(_Src_words, _Size_words);
+    } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+    {
+        for (size_t _Ix = 0; _Ix != _Size_words; ++_Ix) {
+            if (_Src_words[_Ix] != 0) {
+                return true;
             }
-
-            _Traits::_Exit_vectorized(); // TRANSITION, DevCom-10331414
         }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
 
-        template <class _Avx_traits, class _Sse_traits, class _Elem>
-        void __stdcall _Dispatch(_Elem* const _Dest, const void* const _Src, const size_t _Size_bits,
-            const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        return false;
+    }
+}
+
+__declspec(noalias) bool __stdcall __std_bitset_all(const void* const _Src, const size_t _Size_bits) noexcept {
+    using namespace _Bitset_words;
+
+    const auto _Src_words = static_cast<const uint64_t*>(_Src);
 #ifndef _M_ARM64EC
-            if (_Use_avx2() && _Size_bits >= 256) {
-                _Impl<_Avx_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
-            } else if (_Use_sse42()) {
-                _Impl<_Sse_traits>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
-            } else
+    if (_Use_avx2()) {
+        return _All_impl<_Traits_avx>(_Src_words, _Size_bits);
+    } else if (_Use_sse42()) {
+        return _All_impl<_Traits_sse>(_Src_words, _Size_bits);
+    } else
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
-            {
-                const auto _Arr = reinterpret_cast<const uint8_t*>(_Src);
-                for (size_t _Ix = 0; _Ix < _Size_bits; ++_Ix) {
-                    _Dest[_Size_bits - 1 - _Ix] = ((_Arr[_Ix >> 3] >> (_Ix & 7)) & 1) != 0 ? _Elem1 : _Elem0;
-                }
+    {
+        const size_t _Full_words = _Size_bits / 64;
+        for (size_t _Ix = 0; _Ix != _Full_words; ++_Ix) {
+            if (_Src_words[_Ix] != ~uint64_t{0}) {
+                return false;
             }
         }
-    } // namespace _Bitset_to_string
-} // unnamed namespace
 
-extern "C" {
+        const size_t _Tail_bits = _Size_bits % 64;
+        return _Tail_bits == 0 || _Src_words[_Full_words] == (uint64_t{1} << _Tail_bits) - 1;
+    }
+}
 
-__declspec(noalias) void __stdcall __std_bitset_to_string_1(
-    char* const _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
-    using namespace _Bitset_to_string;
-    _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+__declspec(noalias) void __stdcall __std_bitset_shift_left(
+    void* const _Array, const size_t _Size_words, const size_t _Pos) noexcept {
+    using namespace _Bitset_words;
+
+    const auto _Words = static_cast<uint64_t*>(_Array);
+#ifndef _M_ARM64EC
+    if (_Use_avx2()) {
+        _Shift_left_impl<_Traits_avx>(_Words, _Size_words, _Pos / 64, _Pos % 64);
+    } else if (_Use_sse42()) {
+        _Shift_left_impl<_Traits_sse>(_Words, _Size_words, _Pos / 64, _Pos % 64);
+    } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+    {
+        _Shift_left_scalar(_Words, _Size_words, _Pos / 64, _Pos % 64);
+    }
 }
 
-__declspec(noalias) void __stdcall __std_bitset_to_string_2(wchar_t* const _Dest, const void* const _Src,
-    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
-    using namespace _Bitset_to_string;
-    _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bits, _Elem0, _Elem1);
+__declspec(noalias) void __stdcall __std_bitset_shift_right(
+    void* const _Array, const size_t _Size_words, const size_t _Pos) noexcept {
+    using namespace _Bitset_words;
+
+    const auto _Words = static_cast<uint64_t*>(_Array);
+#ifndef _M_ARM64EC
+    if (_Use_avx2()) {
+        _Shift_right_impl<_Traits_avx>(_Words, _Size_words, _Pos / 64, _Pos % 64);
+    } else if (_Use_sse42()) {
+        _Shift_right_impl<_Traits_sse>(_Words, _Size_words, _Pos / 64, _Pos % 64);
+    } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+    {
+        _Shift_right_scalar(_Words, 0, _Size_words, _Pos / 64, _Pos % 64);
+    }
 }
 
 } // extern "C"
 
 namespace {
-    namespace _Bitset_from_string {
+    namespace _Mersenne_twister {
+        template <class _Ty>
+        void _Twist_range(_Ty* const _New, const _Ty* const _Old, size_t _Ix, const size_t _Last, const size_t _Nx,
+            const size_t _Mx, const _Ty _Upper_mask, const _Ty _Xor_mask) noexcept {
+            // computes _New[_Ix] for _Ix in [_Ix, _Last); the state sequence continues from _Old[_Nx - 1] into _New[0]
+            for (; _Ix != _Last; ++_Ix) {
+                const _Ty _Next = _Ix + 1 < _Nx ? _Old[_Ix + 1] : _New[0];
+                const _Ty _Far  = _Ix + _Mx < _Nx ? _Old[_Ix + _Mx] : _New[_Ix + _Mx - _Nx];
+                const _Ty _Tmp  = (_Old[_Ix] & _Upper_mask) | (_Next & ~_Upper_mask);
+                _New[_Ix]       = (_Tmp >> 1) ^ ((_Tmp & 1) != 0 ? _Xor_mask : _Ty{0}) ^ _Far;
+            }
+        }
+
+        template <class _Ty>
+        void _Temper_range(_Ty* const _Dest, const _Ty* const _Src, const size_t _Count, const _Ty _Word_mask,
+            const size_t _Ux, const _Ty _Dx, const size_t _Sx, const _Ty _Bx, const size_t _Tx, const _Ty _Cx,
+            const size_t _Lx) noexcept {
+            for (size_t _Ix = 0; _Ix != _Count; ++_Ix) {
+                _Ty _Res = _Src[_Ix] & _Word_mask;
+                _Res ^= (_Res >> _Ux) & _Dx;
+                _Res ^= (_Res << _Sx) & _Bx;
+                _Res ^= (_Res << _Tx) & _Cx;
+                _Res ^= (_Res & _Word_mask) >> _Lx;
+                _Dest[_Ix] = _Res;
+            }
+        }
+
 #ifdef _M_ARM64EC
-        using _Traits_1_avx = void;
-        using _Traits_1_sse = void;
-        using _Traits_2_avx = void;
-        using _Traits_2_sse = void;
+        using _Traits_4_avx = void;
+        using _Traits_4_sse = void;
+        using _Traits_8_avx = void;
+        using _Traits_8_sse = void;
 #else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
         struct _Traits_avx {
             using _Guard = _Zeroupper_on_exit;
             using _Vec   = __m256i;
 
-            static __m256i _Load(const void* _Src) noexcept {
-                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
             }
 
-            static void _Store(void* _Dest, const __m256i _Val) noexcept {
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            static void _Store(void* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Val);
             }
 
-            static bool _Check(const __m256i _Val, const __m256i _Ex1, const __m256i _Dx0) noexcept {
-                return _mm256_testc_si256(_Ex1, _mm256_xor_si256(_Val, _Dx0));
+            static __m256i _And(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_and_si256(_Lhs, _Rhs);
+            }
+
+            static __m256i _Andnot(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_andnot_si256(_Lhs, _Rhs);
+            }
+
+            static __m256i _Or(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_or_si256(_Lhs, _Rhs);
+            }
+
+            static __m256i _Xor(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_xor_si256(_Lhs, _Rhs);
             }
         };
 
@@ -7091,222 +8545,246 @@ namespace {
             using _Guard = char;
             using _Vec   = __m128i;
 
-            static __m128i _Load(const void* _Src) noexcept {
-                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
             }
 
-            static void _Store(void* _Dest, const __m128i _Val) noexcept {
-                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+            static void _Store(void* const _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
             }
 
-            static bool _Check(const __m128i _Val, const __m128i _Ex1, const __m128i _Dx0) noexcept {
-                return _mm_testc_si128(_Ex1, _mm_xor_si128(_Val, _Dx0));
+            static __m128i _And(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_and_si128(_Lhs, _Rhs);
             }
-        };
 
-        struct _Traits_1_avx : _Traits_avx {
-            static __m256i _Set(const char _Val) noexcept {
-                return _mm256_set1_epi8(_Val);
+            static __m128i _Andnot(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_andnot_si128(_Lhs, _Rhs);
             }
 
-            static uint32_t _To_bits(const __m256i _Ex1) noexcept {
-                const __m256i _Shuf = _mm256_set_epi8( //
-                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
-                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
-
-                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
-                return _rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 16);
+            static __m128i _Or(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_or_si128(_Lhs, _Rhs);
             }
 
-            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
-                return _mm256_cmpeq_epi8(_Val, _Dx1);
+            static __m128i _Xor(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_xor_si128(_Lhs, _Rhs);
             }
         };
 
-        struct _Traits_1_sse : _Traits_sse {
-            static __m128i _Set(const char _Val) noexcept {
-                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+        struct _Traits_4_avx : _Traits_avx {
+            static constexpr size_t _Lanes = 8;
+
+            static __m256i _Set(const uint32_t _Val) noexcept {
+                return _mm256_set1_epi32(static_cast<int>(_Val));
             }
 
-            static uint16_t _To_bits(const __m128i _Ex1) noexcept {
-                const __m128i _Shuf = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
-                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
-                return static_cast<uint16_t>(_mm_movemask_epi8(_Ex2));
+            static __m256i _Shr(const __m256i _Val, const size_t _Count) noexcept {
+                return _mm256_srl_epi32(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
             }
 
-            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
-                return _mm_cmpeq_epi8(_Val, _Dx1);
+            static __m256i _Shl(const __m256i _Val, const size_t _Count) noexcept {
+                return _mm256_sll_epi32(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
+            }
+
+            static __m256i _Low_bit_mask(const __m256i _Val) noexcept {
+                return _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(_Val, _mm256_set1_epi32(1)));
             }
         };
 
-        struct _Traits_2_avx : _Traits_avx {
-            static __m256i _Set(const wchar_t _Val) noexcept {
-                return _mm256_set1_epi16(_Val);
+        struct _Traits_8_avx : _Traits_avx {
+            static constexpr size_t _Lanes = 4;
+
+            static __m256i _Set(const uint64_t _Val) noexcept {
+                return _mm256_set1_epi64x(static_cast<long long>(_Val));
             }
 
-            static uint16_t _To_bits(const __m256i _Ex1) noexcept {
-                const __m256i _Shuf = _mm256_set_epi8( //
-                    +0, +2, +4, +6, +8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1, //
-                    -1, -1, -1, -1, -1, -1, -1, -1, +0, +2, +4, +6, +8, 10, 12, 14);
+            static __m256i _Shr(const __m256i _Val, const size_t _Count) noexcept {
+                return _mm256_srl_epi64(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
+            }
 
-                const __m256i _Ex2 = _mm256_shuffle_epi8(_Ex1, _Shuf);
-                return static_cast<uint16_t>(_rotl(static_cast<uint32_t>(_mm256_movemask_epi8(_Ex2)), 8));
+            static __m256i _Shl(const __m256i _Val, const size_t _Count) noexcept {
+                return _mm256_sll_epi64(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
             }
 
-            static __m256i _Cmp(const __m256i _Val, const __m256i _Dx1) noexcept {
-                return _mm256_cmpeq_epi16(_Val, _Dx1);
+            static __m256i _Low_bit_mask(const __m256i _Val) noexcept {
+                return _mm256_sub_epi64(_mm256_setzero_si256(), _mm256_and_si256(_Val, _mm256_set1_epi64x(1)));
             }
         };
 
-        struct _Traits_2_sse : _Traits_sse {
-            static __m128i _Set(const wchar_t _Val) noexcept {
-                return _mm_set1_epi16(_Val);
+        struct _Traits_4_sse : _Traits_sse {
+            static constexpr size_t _Lanes = 4;
+
+            static __m128i _Set(const uint32_t _Val) noexcept {
+                return _mm_set1_epi32(static_cast<int>(_Val));
             }
 
-            static uint8_t _To_bits(const __m128i _Ex1) noexcept {
-                const __m128i _Shuf = _mm_set_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 4, 6, 8, 10, 12, 14);
-                const __m128i _Ex2  = _mm_shuffle_epi8(_Ex1, _Shuf);
-                return static_cast<uint8_t>(_mm_movemask_epi8(_Ex2));
+            static __m128i _Shr(const __m128i _Val, const size_t _Count) noexcept {
+                return _mm_srl_epi32(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
             }
 
-            static __m128i _Cmp(const __m128i _Val, const __m128i _Dx1) noexcept {
-                return _mm_cmpeq_epi16(_Val, _Dx1);
+            static __m128i _Shl(const __m128i _Val, const size_t _Count) noexcept {
+                return _mm_sll_epi32(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
+            }
+
+            static __m128i _Low_bit_mask(const __m128i _Val) noexcept {
+                return _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(_Val, _mm_set1_epi32(1)));
             }
         };
 
-        template <class _Traits, class _Elem, class _OutFn>
-        bool _Loop(const _Elem* const _Src, const _Elem* _Src_end, const typename _Traits::_Vec _Dx0,
-            const typename _Traits::_Vec _Dx1, _OutFn _Out) noexcept {
-            for (;;) {
-                typename _Traits::_Vec _Val;
-                constexpr size_t _Per_vec = sizeof(_Val) / sizeof(_Elem);
+        struct _Traits_8_sse : _Traits_sse {
+            static constexpr size_t _Lanes = 2;
 
-                if (const size_t _Left = _Src_end - _Src; _Left >= _Per_vec) {
-                    _Src_end -= _Per_vec;
-                    _Val = _Traits::_Load(_Src_end);
-                } else if (_Left == 0) {
-                    return true;
-                } else {
-                    _Src_end = _Src;
-                    _Elem _Tmp[_Per_vec];
-                    _Traits::_Store(_Tmp, _Dx0);
-                    _Elem* const _Tmpd = _Tmp + (_Per_vec - _Left);
-                    memcpy(_Tmpd, _Src_end, _Left * sizeof(_Elem));
-                    _Val = _Traits::_Load(_Tmp);
-                }
+            static __m128i _Set(const uint64_t _Val) noexcept {
+                return _mm_set1_epi64x(static_cast<long long>(_Val));
+            }
 
-                const auto _Ex1 = _Traits::_Cmp(_Val, _Dx1);
+            static __m128i _Shr(const __m128i _Val, const size_t _Count) noexcept {
+                return _mm_srl_epi64(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
+            }
 
-                if (!_Traits::_Check(_Val, _Ex1, _Dx0)) {
-                    return false;
-                }
+            static __m128i _Shl(const __m128i _Val, const size_t _Count) noexcept {
+                return _mm_sll_epi64(_Val, _mm_cvtsi32_si128(static_cast<int>(_Count)));
+            }
 
-                _Out(_Ex1);
+            static __m128i _Low_bit_mask(const __m128i _Val) noexcept {
+                return _mm_sub_epi64(_mm_setzero_si128(), _mm_and_si128(_Val, _mm_set1_epi64x(1)));
             }
+        };
+
+        template <class _Traits>
+        typename _Traits::_Vec _Twist_vec(const typename _Traits::_Vec _Cur, const typename _Traits::_Vec _Next,
+            const typename _Traits::_Vec _Far, const typename _Traits::_Vec _Upper,
+            const typename _Traits::_Vec _Xor_mask) noexcept {
+            const auto _Tmp = _Traits::_Or(_Traits::_And(_Cur, _Upper), _Traits::_Andnot(_Upper, _Next));
+            const auto _Odd = _Traits::_And(_Traits::_Low_bit_mask(_Tmp), _Xor_mask);
+            return _Traits::_Xor(_Traits::_Xor(_Traits::_Shr(_Tmp, 1), _Odd), _Far);
         }
 
-        template <class _Traits, class _Elem>
-        bool _Impl(void* _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
-            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        template <class _Traits, class _Ty>
+        void _Twist_impl(_Ty* const _New, const _Ty* const _Old, const size_t _Nx, const size_t _Mx,
+            const _Ty _Upper_mask, const _Ty _Xor_mask) noexcept {
             [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
-            const auto _Dx0 = _Traits::_Set(_Elem0);
-            const auto _Dx1 = _Traits::_Set(_Elem1);
-
-            void* _Dest_end = _Dest;
-            _Advance_bytes(_Dest_end, _Size_bytes);
-
-            auto _Out = [&_Dest](const _Traits::_Vec _Ex1) {
-                const auto _Val = _Traits::_To_bits(_Ex1);
-                memcpy(_Dest, &_Val, sizeof(_Val));
-                _Advance_bytes(_Dest, sizeof(_Val));
-            };
+            constexpr size_t _Lanes = _Traits::_Lanes;
 
-            const size_t _Size_convert = (_Size_chars <= _Size_bits) ? _Size_chars : _Size_bits;
+            const auto _Upper = _Traits::_Set(_Upper_mask);
+            const auto _Xor   = _Traits::_Set(_Xor_mask);
 
-            // Convert characters to bits
-            if (!_Loop<_Traits>(_Src, _Src + _Size_convert, _Dx0, _Dx1, _Out)) {
-                return false;
+            // below _Far_bound, all three inputs of each element come from _Old
+            const size_t _Far_bound = _Nx - _Mx;
+            size_t _Ix              = 0;
+            for (; _Ix + _Lanes <= _Far_bound; _Ix += _Lanes) {
+                const auto _Val = _Twist_vec<_Traits>(_Traits::_Load(_Old + _Ix), _Traits::_Load(_Old + _Ix + 1),
+                    _Traits::_Load(_Old + _Ix + _Mx), _Upper, _Xor);
+                _Traits::_Store(_New + _Ix, _Val);
             }
 
-            // Verify remaining characters, if any
-            if (_Size_convert != _Size_chars
-                && !_Loop<_Traits>(_Src + _Size_convert, _Src + _Size_chars, _Dx0, _Dx1, [](_Traits::_Vec) {})) {
-                return false;
-            }
+            _Twist_range(_New, _Old, _Ix, _Far_bound, _Nx, _Mx, _Upper_mask, _Xor_mask);
+            _Ix = _Far_bound;
 
-            // Trim tail (may be padding tail, or too short string, or both)
-            if (_Dest != _Dest_end) {
-                memset(_Dest, 0, _Byte_length(_Dest, _Dest_end));
+            // above it, the far input is an element of _New computed at least _Far_bound elements earlier
+            if (_Lanes <= _Far_bound) {
+                for (; _Ix + _Lanes < _Nx; _Ix += _Lanes) {
+                    const auto _Val = _Twist_vec<_Traits>(_Traits::_Load(_Old + _Ix), _Traits::_Load(_Old + _Ix + 1),
+                        _Traits::_Load(_New + _Ix - _Far_bound), _Upper, _Xor);
+                    _Traits::_Store(_New + _Ix, _Val);
+                }
             }
 
-            return true;
+            _Twist_range(_New, _Old, _Ix, _Nx, _Nx, _Mx, _Upper_mask, _Xor_mask);
         }
-#endif // ^^^ !defined(_M_ARM64EC) ^^^
 
-        template <class _Elem>
-        bool _Fallback(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes, const size_t _Size_bits,
-            const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
-            const auto _Dest_bytes = static_cast<uint8_t*>(_Dest);
-            size_t _Size_convert   = _Size_chars;
+        template <class _Traits, class _Ty>
+        void _Temper_impl(_Ty* const _Dest, const _Ty* const _Src, const size_t _Count, const _Ty _Word_mask,
+            const size_t _Ux, const _Ty _Dx, const size_t _Sx, const _Ty _Bx, const size_t _Tx, const _Ty _Cx,
+            const size_t _Lx) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+            constexpr size_t _Lanes = _Traits::_Lanes;
 
-            if (_Size_chars > _Size_bits) {
-                _Size_convert = _Size_bits;
+            const auto _Wmsk = _Traits::_Set(_Word_mask);
+            const auto _Dmsk = _Traits::_Set(_Dx);
+            const auto _Bmsk = _Traits::_Set(_Bx);
+            const auto _Cmsk = _Traits::_Set(_Cx);
 
-                for (size_t _Ix = _Size_bits; _Ix < _Size_chars; ++_Ix) {
-                    if (const _Elem _Cur = _Src[_Ix]; _Cur != _Elem0 && _Cur != _Elem1) {
-                        return false;
-                    }
-                }
+            size_t _Ix = 0;
+            for (; _Ix + _Lanes <= _Count; _Ix += _Lanes) {
+                auto _Res = _Traits::_And(_Traits::_Load(_Src + _Ix), _Wmsk);
+                _Res      = _Traits::_Xor(_Res, _Traits::_And(_Traits::_Shr(_Res, _Ux), _Dmsk));
+                _Res      = _Traits::_Xor(_Res, _Traits::_And(_Traits::_Shl(_Res, _Sx), _Bmsk));
+                _Res      = _Traits::_Xor(_Res, _Traits::_And(_Traits::_Shl(_Res, _Tx), _Cmsk));
+                _Res      = _Traits::_Xor(_Res, _Traits::_Shr(_Traits::_And(_Res, _Wmsk), _Lx));
+                _Traits::_Store(_Dest + _Ix, _Res);
             }
 
-            memset(_Dest, 0, _Size_bytes);
-
-            for (size_t _Ix = 0; _Ix != _Size_convert; ++_Ix) {
-                const _Elem _Cur = _Src[_Size_convert - _Ix - 1];
-
-                if (_Cur != _Elem0 && _Cur != _Elem1) {
-                    return false;
-                }
+            _Temper_range(_Dest + _Ix, _Src + _Ix, _Count - _Ix, _Word_mask, _Ux, _Dx, _Sx, _Bx, _Tx, _Cx, _Lx);
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
 
-                _Dest_bytes[_Ix >> 3] |= static_cast<uint8_t>(_Cur == _Elem1) << (_Ix & 0x7);
+        template <class _Avx, class _Sse, class _Ty>
+        void _Twist_dispatch(void* const _New, const void* const _Old, const size_t _Nx, const size_t _Mx,
+            const _Ty _Upper_mask, const _Ty _Xor_mask) noexcept {
+            const auto _New_ptr = static_cast<_Ty*>(_New);
+            const auto _Old_ptr = static_cast<const _Ty*>(_Old);
+#ifndef _M_ARM64EC
+            if (_Use_avx2()) {
+                _Twist_impl<_Avx>(_New_ptr, _Old_ptr, _Nx, _Mx, _Upper_mask, _Xor_mask);
+            } else if (_Use_sse42()) {
+                _Twist_impl<_Sse>(_New_ptr, _Old_ptr, _Nx, _Mx, _Upper_mask, _Xor_mask);
+            } else
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            {
+                _Twist_range(_New_ptr, _Old_ptr, 0, _Nx, _Nx, _Mx, _Upper_mask, _Xor_mask);
             }
-
-            return true;
         }
 
-        template <class _Avx, class _Sse, class _Elem>
-        bool _Dispatch(void* _Dest, const _Elem* _Src, size_t _Size_bytes, size_t _Size_bits, size_t _Size_chars,
-            _Elem _Elem0, _Elem _Elem1) noexcept {
+        template <class _Avx, class _Sse, class _Ty>
+        void _Temper_dispatch(void* const _Dest, const void* const _Src, const size_t _Count, const _Ty _Word_mask,
+            const size_t _Ux, const _Ty _Dx, const size_t _Sx, const _Ty _Bx, const size_t _Tx, const _Ty _Cx,
+            const size_t _Lx) noexcept {
+            const auto _Dest_ptr = static_cast<_Ty*>(_Dest);
+            const auto _Src_ptr  = static_cast<const _Ty*>(_Src);
 #ifndef _M_ARM64EC
-            if (_Use_avx2() && _Size_bits >= 256) {
-                return _Impl<_Avx>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+            if (_Use_avx2()) {
+                _Temper_impl<_Avx>(_Dest_ptr, _Src_ptr, _Count, _Word_mask, _Ux, _Dx, _Sx, _Bx, _Tx, _Cx, _Lx);
             } else if (_Use_sse42()) {
-                return _Impl<_Sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+                _Temper_impl<_Sse>(_Dest_ptr, _Src_ptr, _Count, _Word_mask, _Ux, _Dx, _Sx, _Bx, _Tx, _Cx, _Lx);
             } else
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
             {
-                return _Fallback(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+                _Temper_range(_Dest_ptr, _Src_ptr, _Count, _Word_mask, _Ux, _Dx, _Sx, _Bx, _Tx, _Cx, _Lx);
             }
         }
-    } // namespace _Bitset_from_string
+    } // namespace _Mersenne_twister
 } // unnamed namespace
 
 extern "C" {
 
-__declspec(noalias) bool __stdcall __std_bitset_from_string_1(void* const _Dest, const char* const _Src,
-    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const char _Elem0,
-    const char _Elem1) noexcept {
-    using namespace _Bitset_from_string;
+__declspec(noalias) void __stdcall __std_mersenne_twister_twist_4(void* const _New, const void* const _Old,
+    const size_t _Nx, const size_t _Mx, const uint32_t _Upper_mask, const uint32_t _Xor_mask) noexcept {
+    using namespace _Mersenne_twister;
 
-    return _Dispatch<_Traits_1_avx, _Traits_1_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+    _Twist_dispatch<_Traits_4_avx, _Traits_4_sse>(_New, _Old, _Nx, _Mx, _Upper_mask, _Xor_mask);
 }
 
-__declspec(noalias) bool __stdcall __std_bitset_from_string_2(void* const _Dest, const wchar_t* const _Src,
-    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const wchar_t _Elem0,
-    const wchar_t _Elem1) noexcept {
-    using namespace _Bitset_from_string;
+__declspec(noalias) void __stdcall __std_mersenne_twister_twist_8(void* const _New, const void* const _Old,
+    const size_t _Nx, const size_t _Mx, const uint64_t _Upper_mask, const uint64_t _Xor_mask) noexcept {
+    using namespace _Mersenne_twister;
 
-    return _Dispatch<_Traits_2_avx, _Traits_2_sse>(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+    _Twist_dispatch<_Traits_8_avx, _Traits_8_sse>(_New, _Old, _Nx, _Mx, _Upper_mask, _Xor_mask);
+}
+
+__declspec(noalias) void __stdcall __std_mersenne_twister_temper_4(void* const _Dest, const void* const _Src,
+    const size_t _Count, const uint32_t _Word_mask, const size_t _Ux, const uint32_t _Dx, const size_t _Sx,
+    const uint32_t _Bx, const size_t _Tx, const uint32_t _Cx, const size_t _Lx) noexcept {
+    using namespace _Mersenne_twister;
+
+    _Temper_dispatch<_Traits_4_avx, _Traits_4_sse>(_Dest, _Src, _Count, _Word_mask, _Ux, _Dx, _Sx, _Bx, _Tx, _Cx, _Lx);
+}
+
+__declspec(noalias) void __stdcall __std_mersenne_twister_temper_8(void* const _Dest, const void* const _Src,
+    const size_t _Count, const uint64_t _Word_mask, const size_t _Ux, const uint64_t _Dx, const size_t _Sx,
+    const uint64_t _Bx, const size_t _Tx, const uint64_t _Cx, const size_t _Lx) noexcept {
+    using namespace _Mersenne_twister;
+
+    _Temper_dispatch<_Traits_8_avx, _Traits_8_sse>(_Dest, _Src, _Count, _Word_mask, _Ux, _Dx, _Sx, _Bx, _Tx, _Cx, _Lx);
 }
 
 } // extern "C"
@@ -12,6 +12,7 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 using namespace std;
 using namespace std::placeholders;
@@ -371,7 +372,53 @@ struct use_async_in_a_global_tester {
 use_async_in_a_global_tester use_async_in_a_global_instance;
 #endif // ^^^ no workaround ^^^
 
+// in an EXE, with either /MT or /MD, async(launch::async) runs on the work-stealing pool in async_pool.cpp
+void test_async_pool() {
+    assert(!stdext::set_async_concurrency(0));
+#ifndef _M_CEE // TRANSITION, VSO-1659511
+    assert(!stdext::set_async_concurrency(2)); // use_async_in_a_global_instance has started the pool
+#else // ^^^ no workaround / workaround vvv
+    assert(stdext::set_async_concurrency(2)); // before the first task starts the pool
+#endif // ^^^ workaround ^^^
+
+    { // tasks scheduled by a task go to its worker's own queue, where other workers steal them
+        future<int> f = async(launch::async, [] {
+            vector<future<int>> children;
+            for (int i = 0; i < 100; ++i) {
+                children.push_back(async(launch::async, [i] { return i; }));
+            }
+
+            int sum = 0;
+            for (auto& child : children) {
+                sum += child.get();
+            }
+
+            return sum;
+        });
+
+        assert(f.get() == 4950);
+        assert(stdext::get_async_pool_statistics().workers != 0);
+    }
+
+    { // more tasks waiting on each other than there are workers, which spare workers have to run
+        promise<void> gate;
+        const shared_future<void> opened = gate.get_future().share();
+        vector<future<void>> waiters;
+        const int waiter_count = static_cast<int>(thread::hardware_concurrency()) + 2;
+        for (int i = 0; i < waiter_count; ++i) {
+            waiters.push_back(async(launch::async, [opened] { opened.wait(); }));
+        }
+
+        future<void> opener = async(launch::async, [&gate] { gate.set_value(); });
+        opener.get();
+        for (auto& waiter : waiters) {
+            waiter.get();
+        }
+    }
+}
+
 int main() {
+    test_async_pool();
     test_DevDiv_235721();
     test_DevDiv_586551();
     test_DevDiv_725337();
@@ -3,7 +3,11 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstddef>
 #include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
@@ -11,6 +15,71 @@ int func() {
     return 1729;
 }
 
+void test_ready_fast_path() {
+    { // satisfied before any wait: wait_for, wait_until, and get don't need to block
+        promise<int> pr;
+        future<int> f = pr.get_future();
+        pr.set_value(42);
+        assert(f.wait_for(chrono::seconds(0)) == future_status::ready);
+        assert(f.wait_until(chrono::steady_clock::now()) == future_status::ready);
+        f.wait();
+        assert(f.valid());
+        assert(f.get() == 42);
+        assert(!f.valid());
+    }
+
+    { // a stored exception is rethrown on every get() of a shared_future
+        promise<int> pr;
+        shared_future<int> f = pr.get_future().share();
+        pr.set_exception(make_exception_ptr(runtime_error("meow")));
+        for (int i = 0; i < 2; ++i) {
+            try {
+                (void) f.get();
+                assert(false);
+            } catch (const runtime_error&) {
+            }
+        }
+
+        assert(f.valid());
+    }
+
+    { // shared futures read the same result
+        promise<int> pr;
+        shared_future<int> f1 = pr.get_future().share();
+        shared_future<int> f2 = f1;
+        pr.set_value(1729);
+        assert(f1.get() == 1729);
+        assert(f2.get() == 1729);
+        assert(f1.get() == 1729);
+        assert(&f1.get() == &f2.get());
+    }
+
+    { // results are published across threads, whether or not the reader finds them ready
+        constexpr size_t count = 1000;
+        vector<promise<vector<int>>> requests(count);
+        vector<future<vector<int>>> futures;
+        for (auto& pr : requests) {
+            futures.push_back(pr.get_future());
+        }
+
+        thread producer{[&] {
+            for (size_t i = 0; i < count; ++i) {
+                requests[i].set_value(vector<int>(i % 16, static_cast<int>(i)));
+            }
+        }};
+
+        for (size_t i = 0; i < count; ++i) {
+            const vector<int> v = futures[i].get();
+            assert(v.size() == i % 16);
+            for (const int e : v) {
+                assert(e == static_cast<int>(i));
+            }
+        }
+
+        producer.join();
+    }
+}
+
 int main() {
     { // DevDiv-482796 "C++11 unexpected behavior for std::future::wait_for and std::packaged_task"
         packaged_task<int()> pt(func);
@@ -50,4 +119,6 @@ int main() {
 
         assert(f.get() == 1729);
     }
+
+    test_ready_fast_path();
 }
@@ -227,6 +227,70 @@ CONSTEXPR20 bool test_count() {
     return true;
 }
 
+CONSTEXPR20 bool test_word_algorithms() {
+    // spans several blocks at offsets that differ between the ranges
+    constexpr size_t length = 3 * blockSize + 13;
+    vector<bool> source(length + 40);
+    for (size_t i = 0; i != source.size(); ++i) {
+        source[i] = (i * i) % 7 < 3;
+    }
+
+    vector<bool> negated(source.size(), true);
+    transform(source.cbegin() + 5, source.cbegin() + 5 + length, negated.begin() + 17, logical_not<>{});
+    for (size_t i = 0; i != length; ++i) {
+        assert(negated[17 + i] == !source[5 + i]);
+    }
+
+    assert(negated[16] && negated[17 + length]);
+
+    vector<bool> combined(source.size());
+    transform(source.cbegin() + 5, source.cbegin() + 5 + length, negated.cbegin() + 17, combined.begin() + 1,
+        bit_or<bool>{});
+    assert(find(combined.cbegin() + 1, combined.cbegin() + 1 + length, false) == combined.cbegin() + 1 + length);
+
+    transform(source.cbegin() + 5, source.cbegin() + 5 + length, negated.cbegin() + 17, combined.begin() + 1,
+        bit_and<>{});
+    assert(find(combined.cbegin() + 1, combined.cbegin() + 1 + length, true) == combined.cbegin() + 1 + length);
+
+    vector<bool> copied(source.size());
+    copy(source.cbegin() + 5, source.cbegin() + 5 + length, copied.begin() + 30);
+    assert(equal(source.cbegin() + 5, source.cbegin() + 5 + length, copied.cbegin() + 30));
+    copied[30 + length - 1].flip();
+    assert(!equal(source.cbegin() + 5, source.cbegin() + 5 + length, copied.cbegin() + 30));
+    const auto mismatched = mismatch(source.cbegin() + 5, source.cbegin() + 5 + length, copied.cbegin() + 30);
+    assert(mismatched.first == source.cbegin() + 5 + (length - 1));
+    assert(mismatched.second == copied.cbegin() + 30 + (length - 1));
+
+    vector<bool> reversed = source;
+    reverse(reversed.begin() + 3, reversed.begin() + 3 + length);
+    for (size_t i = 0; i != length; ++i) {
+        assert(reversed[3 + i] == source[3 + length - 1 - i]);
+    }
+
+    vector<bool> rotated = source;
+    rotate(rotated.begin() + 9, rotated.begin() + 9 + blockSize + 1, rotated.begin() + 9 + length);
+    for (size_t i = 0; i != length; ++i) {
+        assert(rotated[9 + i] == source[9 + (i + blockSize + 1) % length]);
+    }
+
+    vector<bool> swapped = source;
+    swap_ranges(swapped.begin() + 2, swapped.begin() + 2 + length, negated.begin() + 17);
+    for (size_t i = 0; i != length; ++i) {
+        assert(swapped[2 + i] == !source[5 + i]);
+        assert(negated[17 + i] == source[2 + i]);
+    }
+
+#if _HAS_CXX23 // vector<bool>::iterator models output_iterator since P2321R2
+    ranges::fill(swapped.begin() + 7, swapped.begin() + 7 + length, true);
+    assert(ranges::count(swapped.begin() + 7, swapped.begin() + 7 + length, true) == ptrdiff_t{length});
+    ranges::fill_n(swapped.begin() + 7, ptrdiff_t{length}, false);
+    assert(ranges::count(swapped.begin() + 7, swapped.begin() + 7 + length, false) == ptrdiff_t{length});
+    assert(swapped[6] == !source[9] && swapped[7 + length] == source[7 + length]);
+#endif // _HAS_CXX23
+
+    return true;
+}
+
 // Also test the behavior of a huge vector<bool, A> whose size is greater than SIZE_MAX,
 // which is practical on 32-bit platforms.
 template <class T>
@@ -1354,6 +1418,108 @@ void randomized_test_copy(mt19937_64& gen) {
     }
 }
 
+// the reference results are computed on ints, whose algorithms are always element-wise
+bool same_bits(const vector<bool>& vb, const vector<int>& vi) {
+    return equal(vb.cbegin(), vb.cend(), vi.cbegin(), vi.cend(), equal_to<int>{});
+}
+
+void randomized_test_word_algorithms(mt19937_64& gen) {
+    uniform_int_distribution<int> affix_dist{0, 2 * blockSize - 1}; // from nothing to a partial then whole block
+    uniform_int_distribution<int> len_dist{0, 3 * blockSize}; // from nothing to leading/middle/trailing blocks
+    auto bool_dist = [&gen] { return static_cast<bool>(gen() & 1); };
+
+    constexpr int repetitions = 10'000; // tune the number of tests to balance coverage vs. execution time
+
+    for (int k = 0; k < repetitions; ++k) {
+        const int prefix1    = affix_dist(gen);
+        const int prefix2    = affix_dist(gen);
+        const int dst_prefix = affix_dist(gen);
+        const int len        = len_dist(gen);
+
+        // vectors: <prefix1> <len> <suffix>, <prefix2> <len> <suffix>, <dst_prefix> <len> <suffix>
+
+        vector<bool> vb1(prefix1 + len + affix_dist(gen));
+        vector<bool> vb2(prefix2 + len + affix_dist(gen));
+        vector<bool> vb_dst(dst_prefix + len + affix_dist(gen));
+
+        generate(vb1.begin(), vb1.end(), bool_dist);
+        generate(vb2.begin(), vb2.end(), bool_dist);
+        generate(vb_dst.begin(), vb_dst.end(), bool_dist);
+
+        if (len != 0 && bool_dist()) { // make the ranges equal, except for at most one bit
+            copy(vb1.cbegin() + prefix1, vb1.cbegin() + prefix1 + len, vb2.begin() + prefix2);
+            if (bool_dist()) {
+                vb2[prefix2 + uniform_int_distribution<int>{0, len - 1}(gen)].flip();
+            }
+        }
+
+        vector<int> vi_1(vb1.cbegin(), vb1.cend());
+        vector<int> vi_2(vb2.cbegin(), vb2.cend());
+        vector<int> vi_dst(vb_dst.cbegin(), vb_dst.cend());
+
+        const auto vb_first1 = vb1.begin() + prefix1;
+        const auto vb_last1  = vb_first1 + len;
+        const auto vb_first2 = vb2.begin() + prefix2;
+        const auto vi_first1 = vi_1.begin() + prefix1;
+        const auto vi_last1  = vi_first1 + len;
+        const auto vi_first2 = vi_2.begin() + prefix2;
+
+        assert(equal(vb_first1, vb_last1, vb_first2) == equal(vi_first1, vi_last1, vi_first2));
+
+        const auto vb_mismatched = mismatch(vb_first1, vb_last1, vb_first2, vb_first2 + len);
+        const auto vi_mismatched = mismatch(vi_first1, vi_last1, vi_first2);
+        assert(vb_mismatched.first - vb_first1 == vi_mismatched.first - vi_first1);
+        assert(vb_mismatched.second - vb_first2 == vi_mismatched.second - vi_first2);
+
+        const auto test_transform = [&](const auto op) {
+            vector<bool> vb_out       = vb_dst;
+            vector<int> vi_out        = vi_dst;
+            const auto vb_out_last    = transform(vb_first1, vb_last1, vb_first2, vb_out.begin() + dst_prefix, op);
+            const auto vi_out_last    = transform(vi_first1, vi_last1, vi_first2, vi_out.begin() + dst_prefix, op);
+            const bool same_positions = vb_out_last - vb_out.begin() == vi_out_last - vi_out.begin();
+            if (!same_positions || !same_bits(vb_out, vi_out)) {
+                printf("   prefix1: %d\n", prefix1);
+                printf("   prefix2: %d\n", prefix2);
+                printf("dst_prefix: %d\n", dst_prefix);
+                printf("       len: %d\n", len);
+
+                print_vec("     Got", vb_out);
+                print_vec("Expected", vi_out);
+
+                assert(false);
+            }
+        };
+
+        test_transform(bit_and<>{});
+        test_transform(bit_or<bool>{});
+        test_transform(bit_xor<>{});
+        test_transform(logical_and<bool>{});
+        test_transform(logical_or<>{});
+
+        transform(vb_first1, vb_last1, vb_dst.begin() + dst_prefix, logical_not<>{});
+        transform(vi_first1, vi_last1, vi_dst.begin() + dst_prefix, logical_not<>{});
+        assert(same_bits(vb_dst, vi_dst));
+
+        transform(vb_first1, vb_last1, vb_first1, logical_not<bool>{}); // in place
+        transform(vi_first1, vi_last1, vi_first1, logical_not<bool>{});
+        assert(same_bits(vb1, vi_1));
+
+        reverse(vb_first1, vb_last1);
+        reverse(vi_first1, vi_last1);
+        assert(same_bits(vb1, vi_1));
+
+        const int mid = uniform_int_distribution<int>{0, len}(gen);
+        rotate(vb_first1, vb_first1 + mid, vb_last1);
+        rotate(vi_first1, vi_first1 + mid, vi_last1);
+        assert(same_bits(vb1, vi_1));
+
+        assert(swap_ranges(vb_first1, vb_last1, vb_first2) == vb_first2 + len);
+        swap_ranges(vi_first1, vi_last1, vi_first2);
+        assert(same_bits(vb1, vi_1));
+        assert(same_bits(vb2, vi_2));
+    }
+}
+
 #if _HAS_CXX20
 template <size_t N, size_t Offset = 0>
 constexpr bool test_gh_5345() {
@@ -1385,6 +1551,7 @@ static_assert(test_gh_5345<120, 31>());
 static_assert(test_fill());
 static_assert(test_find());
 static_assert(test_count());
+static_assert(test_word_algorithms());
 
 #if defined(__clang__) || defined(__EDG__) // TRANSITION, VSO-2574489
 static_assert(test_copy_part_1());
@@ -1396,6 +1563,7 @@ int main() {
     test_fill();
     test_find();
     test_count();
+    test_word_algorithms();
     test_copy_part_1();
     test_copy_part_2();
 
@@ -1404,4 +1572,5 @@ int main() {
     mt19937_64 gen;
     initialize_randomness(gen);
     randomized_test_copy(gen);
+    randomized_test_word_algorithms(gen);
 }
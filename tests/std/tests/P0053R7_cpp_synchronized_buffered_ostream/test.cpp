@@ -1,6 +1,11 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "test.hpp"
 
 using namespace std;
@@ -359,6 +364,48 @@ void test_osyncstream(string_buffer<typename Alloc::value_type>* buf = nullptr)
     }
 }
 
+void test_concurrent_emission() {
+    // Threads alternate between a shared wrapped streambuf and their own, so that the mutexes for the wrapped
+    // streambufs are created and released concurrently.
+    constexpr size_t thread_count = 8;
+    constexpr size_t line_count   = 1000;
+
+    string_buffer<char> shared_buffer;
+    vector<string_buffer<char>> own_buffers(thread_count);
+    vector<thread> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+            const string line = "thread " + to_string(i) + " has written a line that takes more than one buffer\n";
+            for (size_t j = 0; j < line_count; ++j) {
+                osyncstream{j % 2 == 0 ? &shared_buffer : &own_buffers[i]} << line;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    for (size_t i = 0; i < thread_count; ++i) {
+        const string line = "thread " + to_string(i) + " has written a line that takes more than one buffer\n";
+        string expected;
+        for (size_t j = 0; j < line_count / 2; ++j) {
+            expected += line;
+        }
+
+        assert(own_buffers[i].str == expected);
+    }
+
+    // every line must have been emitted whole
+    const auto& str = shared_buffer.str;
+    assert(static_cast<size_t>(count(str.begin(), str.end(), '\n')) == thread_count * line_count / 2);
+    for (size_t first = 0; first != str.size();) {
+        const size_t last = str.find('\n', first) + 1;
+        assert(str.compare(first + 8, last - first - 8, " has written a line that takes more than one buffer\n") == 0);
+        first = last;
+    }
+}
+
 int main() {
     string_buffer<char> char_buffer{};
     string_buffer<char, true> no_sync_char_buffer{};
@@ -384,4 +431,6 @@ int main() {
 
     test_osyncstream<allocator<char>>(&char_buffer);
     test_osyncstream<small_size_allocator<char>>(&char_buffer);
+
+    test_concurrent_emission();
 }
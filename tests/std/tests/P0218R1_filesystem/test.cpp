@@ -18,7 +18,9 @@
 #include <iterator>
 #include <locale>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -1524,6 +1526,104 @@ void test_recursive_directory_iterator() {
     }
 }
 
+set<wstring> parallel_walk_paths(const path& root, const directory_options options = directory_options::none) {
+    mutex mtx;
+    set<wstring> result;
+    stdext::parallel_directory_walk(
+        root,
+        [&](const path& dir, const vector<directory_entry>& entries) {
+            for (const auto& entry : entries) {
+                EXPECT(entry.path().parent_path().native() == dir.native());
+            }
+
+            const lock_guard<mutex> lock(mtx);
+            for (const auto& entry : entries) {
+                EXPECT(result.insert(entry.path().native()).second);
+            }
+        },
+        options);
+    return result;
+}
+
+set<wstring> recursive_iterator_paths(const path& root, const directory_options options = directory_options::none) {
+    set<wstring> result;
+    for (const auto& entry : recursive_directory_iterator(root, options)) {
+        result.insert(entry.path().native());
+    }
+
+    return result;
+}
+
+void test_parallel_directory_walk() {
+    const test_temp_directory tempDir("parallel_directory_walk"sv);
+    const path& root = tempDir.directoryPath;
+
+    // more entries than fit in one batch, and enough directories to keep several workers busy
+    for (int i = 0; i < 20; ++i) {
+        const path dir = root / to_wstring(i);
+        create_directories(dir / L"nested/deeper"sv);
+        for (int j = 0; j < 30; ++j) {
+            create_file_containing(dir / (L"file"s + to_wstring(j)), L"contents");
+        }
+
+        create_file_containing(dir / L"nested/deeper/leaf.txt"sv, L"leaf");
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        create_file_containing(root / (L"top"s + to_wstring(i)), L"top");
+    }
+
+    const auto expected = recursive_iterator_paths(root);
+    EXPECT(expected.size() == 20 * 33 + 200);
+    EXPECT(parallel_walk_paths(root) == expected);
+
+    // the cached status comes from the directory listing
+    stdext::parallel_directory_walk(root, [](const path&, const vector<directory_entry>& entries) {
+        for (const auto& entry : entries) {
+            const auto name = entry.path().filename().native();
+            if (starts_with(wstring_view{name}, L"file"sv)) {
+                EXPECT(entry.is_regular_file());
+                EXPECT(entry.file_size() == 8);
+            } else if (name == L"nested"sv) {
+                EXPECT(entry.is_directory());
+            }
+        }
+    });
+
+    // exceptions thrown by the callback stop the walk and are rethrown
+    try {
+        stdext::parallel_directory_walk(root, [](const path&, const vector<directory_entry>&) { throw 1729; });
+        EXPECT(false);
+    } catch (const int i) {
+        EXPECT(i == 1729);
+    }
+
+    // errors are reported like recursive_directory_iterator does
+    const auto ignore_entries = [](const path&, const vector<directory_entry>&) {};
+    EXPECT(throws_filesystem_error([&] { stdext::parallel_directory_walk(nonexistentPaths[0], ignore_entries); },
+        "parallel_directory_walk", nonexistentPaths[0]));
+
+    error_code ec;
+    stdext::parallel_directory_walk(nonexistentPaths[0], ignore_entries, directory_options::none, ec);
+    EXPECT(bad(ec));
+
+    {
+        const test_temp_directory emptyDir("parallel_directory_walk-empty"sv);
+        EXPECT(parallel_walk_paths(emptyDir.directoryPath).empty());
+    }
+
+    // broken symlinks are skipped when following symlinks, see VSO-649431
+    create_directory_symlink(nonexistentPaths[0], root / L"broken"sv, ec);
+    if (ec) {
+        check_symlink_permissions(ec, L"parallel_directory_walk");
+    } else {
+        create_directory_symlink(root / L"0"sv, root / L"link"sv);
+        for (const auto options : {directory_options::none, directory_options::follow_directory_symlink}) {
+            EXPECT(parallel_walk_paths(root, options) == recursive_iterator_paths(root, options));
+        }
+    }
+}
+
 void expect_absolute(const path& input, const wstring_view expected) {
     error_code ec(-1, generic_category());
     const path actual = absolute(input, ec);
@@ -3119,6 +3219,47 @@ void test_lexically_normal() {
                .lexically_normal()
                .native()
            == LR"(\\server\other\x\meow.txt)"sv);
+
+    // a root-name without a root-directory keeps its dot-dots
+    EXPECT(path(LR"(C:..)"sv).lexically_normal().native() == LR"(C:..)"sv);
+    EXPECT(path(LR"(C:..\)"sv).lexically_normal().native() == LR"(C:..)"sv);
+    EXPECT(path(LR"(C:..\..)"sv).lexically_normal().native() == LR"(C:..\..)"sv);
+    EXPECT(path(LR"(C:a\..)"sv).lexically_normal().native() == LR"(C:)"sv);
+    EXPECT(path(LR"(C:a\b\..\..)"sv).lexically_normal().native() == LR"(C:)"sv);
+    EXPECT(path(LR"(C:.)"sv).lexically_normal().native() == LR"(C:)"sv);
+    EXPECT(path(LR"(C:.\)"sv).lexically_normal().native() == LR"(C:)"sv);
+
+    // dot-dots right after a root-directory are removed, however the root is spelled
+    EXPECT(path(LR"(C:\..)"sv).lexically_normal().native() == LR"(C:\)"sv);
+    EXPECT(path(LR"(C:/..)"sv).lexically_normal().native() == LR"(C:\)"sv);
+    EXPECT(path(LR"(C:\..\..\)"sv).lexically_normal().native() == LR"(C:\)"sv);
+    EXPECT(path(LR"(C:\a\..\..\b)"sv).lexically_normal().native() == LR"(C:\b)"sv);
+    EXPECT(path(LR"(//server/..)"sv).lexically_normal().native() == LR"(\\server\)"sv);
+    EXPECT(path(LR"(\\server\..\..\share)"sv).lexically_normal().native() == LR"(\\server\share)"sv);
+    EXPECT(path(LR"(//server/share/..)"sv).lexically_normal().native() == LR"(\\server\)"sv);
+    EXPECT(path(LR"(\\?\..)"sv).lexically_normal().native() == LR"(\\?\)"sv);
+    EXPECT(path(LR"(\\.\..)"sv).lexically_normal().native() == LR"(\\.\)"sv);
+    EXPECT(path(LR"(/..)"sv).lexically_normal().native() == LR"(\)"sv);
+
+    // runs of dots and dot-dots
+    EXPECT(path(LR"(..\)"sv).lexically_normal().native() == LR"(..)"sv);
+    EXPECT(path(LR"(.\..\.)"sv).lexically_normal().native() == LR"(..)"sv);
+    EXPECT(path(LR"(a\.\..\.)"sv).lexically_normal().native() == LR"(.)"sv);
+    EXPECT(path(LR"(./././)"sv).lexically_normal().native() == LR"(.)"sv);
+    EXPECT(path(LR"(a\..\..\b)"sv).lexically_normal().native() == LR"(..\b)"sv);
+    EXPECT(path(LR"(a/../b/../c)"sv).lexically_normal().native() == LR"(c)"sv);
+    EXPECT(path(LR"(a\b\..\..\..\..\c)"sv).lexically_normal().native() == LR"(..\..\c)"sv);
+    EXPECT(path(LR"(a/b/./../../c/..)"sv).lexically_normal().native() == LR"(.)"sv);
+
+    // filenames that merely contain dots are neither dot nor dot-dot
+    EXPECT(path(LR"(...\..)"sv).lexically_normal().native() == LR"(.)"sv);
+    EXPECT(path(LR"(a..\..)"sv).lexically_normal().native() == LR"(.)"sv);
+    EXPECT(path(LR"(.a\..)"sv).lexically_normal().native() == LR"(.)"sv);
+
+    // separators
+    EXPECT(path(LR"(//server//share//)"sv).lexically_normal().native() == LR"(\\server\share\)"sv);
+    EXPECT(path(LR"(C:/a\/b//\\c)"sv).lexically_normal().native() == LR"(C:\a\b\c)"sv);
+    EXPECT(path(LR"(//server/./x/../y)"sv).lexically_normal().native() == LR"(\\server\y)"sv);
 }
 
 void test_lexically_relative() {
@@ -3164,6 +3305,28 @@ void test_lexically_relative() {
     // UNC/DOS together should return an empty path
     EXPECT(path(LR"(a:\meow)"sv).lexically_relative(LR"(\\?\a:\meow)"sv).native().empty());
     EXPECT(path(LR"(\\?\a:\meow)"sv).lexically_relative(LR"(a:\meow)"sv).native().empty());
+
+    // root-directories are equal however they're spelled; a trailing empty element is kept
+    EXPECT(path(LR"(C:/a//b)"sv).lexically_relative(LR"(C:\\a)"sv).native() == LR"(b)"sv);
+    EXPECT(path(LR"(a\b\)"sv).lexically_relative(LR"(a)"sv).native() == LR"(b\)"sv);
+    EXPECT(path(LR"(a\b\)"sv).lexically_relative(LR"(a\c)"sv).native() == LR"(..\b\)"sv);
+
+    // root-names are compared as spelled
+    EXPECT(path(LR"(C:a\b)"sv).lexically_relative(LR"(C:a)"sv).native() == LR"(b)"sv);
+    EXPECT(path(LR"(C:a)"sv).lexically_relative(LR"(c:a)"sv).native() == LR"()"sv);
+    EXPECT(path(LR"(C:a)"sv).lexically_relative(LR"(C:\a)"sv).native() == LR"()"sv);
+    EXPECT(path(LR"(C:\a)"sv).lexically_relative(LR"(C:a)"sv).native() == LR"()"sv);
+    EXPECT(path(LR"(\\server\share\a)"sv).lexically_relative(LR"(\\server\share\b)"sv).native() == LR"(..\a)"sv);
+    EXPECT(path(LR"(\\server\share)"sv).lexically_relative(LR"(\\other\share)"sv).native() == LR"()"sv);
+    EXPECT(path(LR"(//server/a)"sv).lexically_relative(LR"(\\server\a)"sv).native() == LR"()"sv);
+    EXPECT(path(LR"(\\?\a)"sv).lexically_relative(LR"(\\.\a)"sv).native() == LR"()"sv);
+
+    // only the root is left
+    EXPECT(path(LR"(C:\)"sv).lexically_relative(LR"(C:\)"sv).native() == LR"(.)"sv);
+    EXPECT(path(LR"(C:\)"sv).lexically_relative(LR"(C:\a\..)"sv).native() == LR"(.)"sv);
+    EXPECT(path(LR"(C:\a)"sv).lexically_relative(LR"(C:\)"sv).native() == LR"(a)"sv);
+    EXPECT(path(LR"(C:\)"sv).lexically_relative(LR"(C:\a\b)"sv).native() == LR"(..\..)"sv);
+    EXPECT(path(LR"(C:)"sv).lexically_relative(LR"(C:..)"sv).native() == LR"()"sv);
 }
 
 void test_lexically_proximate() {
@@ -4000,6 +4163,8 @@ int run_all_tests(int argc, wchar_t* argv[]) {
 
     test_recursive_directory_iterator();
 
+    test_parallel_directory_walk();
+
     test_absolute();
 
     test_canonical();
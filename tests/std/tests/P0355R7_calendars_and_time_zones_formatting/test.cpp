@@ -363,6 +363,33 @@ void test_clock_formatter() {
     // TRANSITION: Test a leap second insertion after 2018-06 when there is one
 }
 
+template <typename CharT>
+void test_fixed_layout_formatter() {
+    // Layouts made only of literals and zero-padded numeric fields are written without an ostringstream.
+    const sys_time<milliseconds> tp = sys_days{2024y / March / 5d} + 7h + 8min + 9s + 45ms;
+    assert(format(STR("{:%Y-%m-%dT%H:%M:%S}"), tp) == STR("2024-03-05T07:08:09.045"));
+    assert(format(STR("{:%FT%TZ}"), tp) == STR("2024-03-05T07:08:09.045Z"));
+    assert(format(STR("{:%R%n%%%t%d}"), tp) == STR("07:08\n%\t05"));
+    assert(format(STR("{:*>28%F %T}"), tp) == STR("*****2024-03-05 07:08:09.045"));
+    assert(format(STR("{:{}%F}"), tp, 12) == STR("2024-03-05  "));
+    empty_braces_helper(tp, STR("2024-03-05 07:08:09.045"));
+    empty_braces_helper(local_time<milliseconds>{tp.time_since_epoch()}, STR("2024-03-05 07:08:09.045"));
+
+    assert(format(STR("{:%F %T}"), sys_time<nanoseconds>{} + 1ns) == STR("1970-01-01 00:00:00.000000001"));
+    assert(format(STR("{:%F %T}"), sys_time<duration<long long, ratio<1, 3>>>{duration<long long, ratio<1, 3>>{1}})
+           == STR("1970-01-01 00:00:00.333333"));
+    assert(format(STR("{:%T}"), sys_seconds{} - 1s) == STR("23:59:59"));
+    assert(format(STR("{:%F %T}"), sys_days{-1y / December / 31d}) == STR("-0001-12-31 00:00:00"));
+    assert(format(STR("{:%F}"), sys_days{12345y / January / 1d}) == STR("12345-01-01"));
+
+    // too long for the fixed layout buffer, so this falls back to the general path
+    basic_string<CharT> expected;
+    for (int i = 0; i < 12; ++i) {
+        expected += STR("2024-03-05");
+    }
+    assert(format(STR("{:%F%F%F%F%F%F%F%F%F%F%F%F}"), tp) == expected);
+}
+
 template <typename CharT>
 void test_day_formatter() {
     using view_typ = basic_string_view<CharT>;
@@ -1074,6 +1101,9 @@ void test() {
     test_clock_formatter<char>();
     test_clock_formatter<wchar_t>();
 
+    test_fixed_layout_formatter<char>();
+    test_fixed_layout_formatter<wchar_t>();
+
     test_day_formatter<char>();
     test_day_formatter<wchar_t>();
 
@@ -1215,6 +1215,59 @@ void parse_timepoints() {
     assert(ut == clock_cast<utc_clock>(sys_days{1d / January / 2017y}) - 1s);
 }
 
+void parse_fixed_layouts() {
+    // Zero-padded numeric layouts are parsed straight from the stream buffer; check that they agree with the general
+    // parser, including which characters are consumed and when eofbit is set.
+    const sys_seconds ref = sys_days{2020y / October / 29d} + 19h + 1min + 42s;
+    sys_seconds st;
+    sys_time<milliseconds> st_ms;
+    local_seconds lt;
+    utc_seconds ut;
+    year_month_day ymd;
+
+    test_parse("2020-10-29T19:01:42", "%Y-%m-%dT%H:%M:%S", st);
+    assert(st == ref);
+    test_parse(L"2020-10-29 19:01:42", L"%F %T", st);
+    assert(st == ref);
+    test_parse("2020-10-29T19:01", "%FT%R", st);
+    assert(st == ref - 42s);
+    test_parse("2020-10-29 19:01:42", "%F %T", lt);
+    assert(lt.time_since_epoch() == ref.time_since_epoch());
+    test_parse("2020-10-29", "%F", ymd);
+    assert(ymd == 29d / October / 2020y);
+
+    // not zero-padded or with extra whitespace; these take the general path
+    test_parse("2020-10-29   19:01:42", "%F %T", st);
+    assert(st == ref);
+    test_parse("2020-10-29 19:1:42", "%F %T", st);
+    assert(st == ref);
+
+    test_parse("2020-10-29T19:01:42.125Z", "%FT%TZ", st_ms);
+    assert(st_ms == ref + 125ms);
+    test_parse(L"2020-10-29T19:01:42Z", L"%FT%TZ", st_ms);
+    assert(st_ms == ref);
+    test_parse("2020-10-29T19:01:42.5", "%FT%T", st_ms);
+    assert(st_ms == ref + 500ms);
+    fail_parse("2020-10-29T19:01:42.125", "%FT%TZ", st_ms);
+    fail_parse("2020-10-29T19:01:42.125+", "%FT%TZ", st_ms);
+
+    assert(parse_state("2020-10-29T19:01:42", "%FT%T", st) == ios_base::eofbit);
+    assert(parse_state("2020-10-29T19:01:42 ", "%FT%T", st) == ios_base::goodbit);
+    assert(parse_state("2020-10-29T19:01:42Z", "%FT%TZ", st) == ios_base::goodbit);
+    assert(parse_state("2020-10-29T19:01:42.125", "%FT%T", st_ms) == ios_base::eofbit);
+
+    // values are validated as usual
+    fail_parse("2020-02-30T00:00:00", "%FT%T", st);
+    fail_parse("2020-13-01T00:00:00", "%FT%T", st);
+    fail_parse("2020-10-29T24:00:00", "%FT%T", st);
+    fail_parse("2020-10-29T19:01:60", "%FT%T", st);
+    fail_parse("2020-10-29T19:01", "%FT%T", st);
+    fail_parse("2020-10-29 2021", "%F %Y", st);
+
+    test_parse("2016-12-31 23:59:60", "%F %T", ut);
+    assert(ut == clock_cast<utc_clock>(sys_days{1d / January / 2017y}) - 1s);
+}
+
 template <class CharT, class CStringOrStdString>
 void test_io_manipulator() {
     seconds time;
@@ -1305,6 +1358,7 @@ void test_parse() {
     parse_incomplete();
     parse_whitespace();
     parse_timepoints();
+    parse_fixed_layouts();
     test_io_manipulator<char, const char*>();
     test_io_manipulator<wchar_t, const wchar_t*>();
     test_io_manipulator<char, string>();
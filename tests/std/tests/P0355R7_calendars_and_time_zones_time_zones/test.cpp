@@ -47,6 +47,33 @@ void test_time_zone_and_link(const tzdb& my_tzdb, string_view tz_name, string_vi
     assert(_Locate_zone_impl(my_tzdb.links, tz_name) == nullptr);
 }
 
+void timezone_locate_every_name_test() {
+    // locate_zone searches a hash table; compare it with the sorted vectors
+    const auto& my_tzdb = get_tzdb();
+    for (const auto& tz : my_tzdb.zones) {
+        assert(my_tzdb.locate_zone(tz.name()) == &tz);
+    }
+
+    for (const auto& link : my_tzdb.links) {
+        const auto target = _Locate_zone_impl(my_tzdb.zones, link.target());
+        if (target != nullptr) {
+            assert(my_tzdb.locate_zone(link.name()) == target);
+        }
+    }
+
+    assert(locate_zone(my_tzdb.zones.front().name()) == &my_tzdb.zones.front());
+    assert(_Find_tzdb_name_index(&my_tzdb) != nullptr);
+
+    // tzdbs outside the tzdb_list have no index and are searched directly
+    tzdb other_tzdb{};
+    assert(_Find_tzdb_name_index(&other_tzdb) == nullptr);
+    try {
+        (void) other_tzdb.locate_zone(my_tzdb.zones.front().name());
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+}
+
 void try_locate_invalid_zone(const tzdb& my_tzdb, string_view name) {
     try {
         (void) my_tzdb.locate_zone(name);
@@ -402,15 +429,45 @@ void timezone_sorted_vectors_test() {
     assert(ranges::is_sorted(my_tzdb.leap_seconds));
 }
 
+void timezone_cached_info_test() {
+    // Conversions are answered from a table of periods that grows when times outside it are converted;
+    // jump around to make it grow in both directions, and check that the periods stay consecutive.
+    const auto& my_tzdb = get_tzdb();
+    for (const auto& tz_name : {LA::Tz_name, Sydney::Tz_name, "Etc/UTC"sv}) {
+        const auto tz = my_tzdb.locate_zone(tz_name);
+        assert(tz != nullptr);
+
+        for (const int start_year : {2020, 1850, 2400, 1995, 1600}) {
+            sys_seconds time = sys_days{year{start_year} / January / 1};
+            for (int step = 0; step < 16; ++step, time += days{97}) {
+                const auto info = tz->get_info(time);
+                assert(info.begin <= time && time < info.end);
+                assert(sys_equal(tz->get_info(info.begin), info));
+                if (info.begin != time_zone::_Min_seconds) {
+                    assert(tz->get_info(info.begin - seconds{1}).end == info.begin);
+                }
+
+                if (info.end != time_zone::_Max_seconds) {
+                    assert(tz->get_info(info.end).begin == info.end);
+                }
+
+                assert(tz->to_local(time) == local_seconds{time.time_since_epoch() + info.offset});
+            }
+        }
+    }
+}
+
 void test() {
     timezone_tzdb_list_test();
     timezone_version_test();
     timezone_names_test();
+    timezone_locate_every_name_test();
     timezone_sys_info_test();
     timezone_to_local_test();
     timezone_local_info_test();
     timezone_precision_test();
     timezone_sorted_vectors_test();
+    timezone_cached_info_test();
 }
 
 int main() {
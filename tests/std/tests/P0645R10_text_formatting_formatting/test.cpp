@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <charconv>
+#include <cmath>
 #include <cstdio>
 #include <exception>
 #include <format>
@@ -1548,6 +1550,61 @@ void test_gh_4320() {
             "00000000000000000000000000000000000e+00"));
 }
 
+// Floating-point values formatted with the common specs are written directly into the format buffer;
+// exercise that path as the buffer fills up, and make sure it agrees with the general path.
+template <class charT>
+void test_float_direct_write() {
+    const double values[] = {0.0, -0.0, 1.0, -1.5, 3.14159, 1729.0, 1e-7, -2.5e22, 1.7976931348623157e308,
+        5e-324, numeric_limits<double>::infinity(), -numeric_limits<double>::infinity()};
+
+    for (const double val : values) {
+        char buf[2048];
+        basic_string<charT> expected_default;
+        basic_string<charT> expected_fixed;
+        basic_string<charT> expected_general;
+        {
+            const auto [last, ec] = to_chars(buf, end(buf), val);
+            assert(ec == errc{});
+            expected_default.assign(buf, last);
+        }
+        {
+            const auto [last, ec] = to_chars(buf, end(buf), val, chars_format::fixed, 2);
+            assert(ec == errc{});
+            expected_fixed.assign(buf, last);
+        }
+        {
+            const auto [last, ec] = to_chars(buf, end(buf), val, chars_format::general, 6);
+            assert(ec == errc{});
+            expected_general.assign(buf, last);
+        }
+
+        // Shift the value through every offset of the internal buffer.
+        for (size_t prefix = 0; prefix < 300; ++prefix) {
+            const basic_string<charT> pad(prefix, charT{'*'});
+            assert(format(STR("{}{}"), pad, val) == pad + expected_default);
+            assert(format(STR("{}{:.2f}"), pad, val) == pad + expected_fixed);
+            assert(format(STR("{}{:g}"), pad, val) == pad + expected_general);
+            assert(formatted_size(STR("{}{:.2f}"), pad, val) == prefix + expected_fixed.size());
+
+            basic_string<charT> truncated(prefix + 1, charT{'#'});
+            const auto result =
+                format_to_n(truncated.begin(), static_cast<ptrdiff_t>(prefix + 1), STR("{}{}"), pad, val);
+            assert(result.size == static_cast<ptrdiff_t>(prefix + expected_default.size()));
+            assert(truncated == (pad + expected_default).substr(0, prefix + 1));
+        }
+
+        assert(format(STR("{:+}"), val) == (signbit(val) ? STR("") : STR("+")) + expected_default);
+        if (expected_fixed.size() < 40) {
+            const basic_string<charT> padding(40 - expected_fixed.size(), charT{' '});
+            assert(format(STR("{:>40.2f}"), val) == padding + expected_fixed);
+        }
+    }
+
+    // Large fixed outputs don't fit in the internal buffer and must fall back.
+    assert(format(STR("{:.2f}"), 1e300).size() == 304);
+    assert(format(STR("{:.1074f}"), 5e-324).size() == 1076);
+}
+
 void test() {
     test_simple_formatting<char>();
     test_simple_formatting<wchar_t>();
@@ -1634,6 +1691,9 @@ void test() {
     test_gh_4319<wchar_t>();
     test_gh_4320<char>();
     test_gh_4320<wchar_t>();
+
+    test_float_direct_write<char>();
+    test_float_direct_write<wchar_t>();
 }
 
 int main() {
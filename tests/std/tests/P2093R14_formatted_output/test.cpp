@@ -655,6 +655,57 @@ void test_empty_strings_and_newlines() {
     filesystem::remove(temp_file_name_str);
 }
 
+void test_print_batch() {
+    const string temp_file_name_str = temp_file_name();
+
+    {
+        FILE* temp_file_stream = checked_fopen_s(temp_file_name_str, "w");
+
+        stdext::print_batch batch;
+        assert(batch.empty());
+        batch.flush(temp_file_stream); // nothing to print
+
+        batch.print("NCC-{}", 1701);
+        batch.println("-D");
+        batch.println();
+        batch.println("{{}} for {}!", "impact");
+        assert(batch.view() == "NCC-1701-D\n\n{} for impact!\n");
+
+        print(temp_file_stream, "first ");
+        batch.flush(temp_file_stream);
+        assert(batch.empty());
+
+        batch.println("discarded");
+        batch.clear();
+        assert(batch.empty());
+
+        for (int i = 0; i < 100; ++i) {
+            batch.println("line {}", i);
+        }
+
+        batch.flush(temp_file_stream);
+        fclose(temp_file_stream);
+    }
+
+    {
+        ifstream input_file_stream{temp_file_name_str};
+
+        vector<string> lines;
+        for (string str; getline(input_file_stream, str);) {
+            lines.push_back(str);
+        }
+
+        vector<string> expected_lines{"first NCC-1701-D", "", "{} for impact!"};
+        for (int i = 0; i < 100; ++i) {
+            expected_lines.push_back("line " + to_string(i));
+        }
+
+        assert(lines == expected_lines);
+    }
+
+    filesystem::remove(temp_file_name_str);
+}
+
 void all_tests() {
     test_print_optimizations();
 
@@ -665,6 +716,8 @@ void all_tests() {
     test_stream_flush_file();
 
     test_empty_strings_and_newlines();
+
+    test_print_batch();
 }
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <Windows.h>
+#include <TlHelp32.h>
+
+using namespace std;
+
+#ifndef _M_CEE_PURE
+string read_file(const char* const filename) {
+    ifstream file(filename, ios::binary);
+    assert(file.is_open());
+    return string{istreambuf_iterator<char>{file}, istreambuf_iterator<char>{}};
+}
+
+void test_write_and_close() {
+    const char* const filename = "test_write_and_close.txt";
+    string expected;
+    {
+        stdext::async_filebuf buf;
+        assert(!buf.is_open());
+        assert(buf.open(filename, ios::out | ios::binary, 16, 2) == &buf); // tiny buffers to force many hand-offs
+        assert(buf.is_open());
+
+        ostream os(&buf);
+        for (int i = 0; i < 1000; ++i) {
+            const string line = "line " + to_string(i) + '\n';
+            os << line;
+            expected += line;
+        }
+
+        os.write(expected.data(), 100); // longer than a buffer
+        expected.append(expected.data(), 100);
+        assert(os.good());
+        assert(buf.close() == &buf);
+        assert(!buf.is_open());
+        assert(buf.close() == nullptr);
+    }
+
+    assert(read_file(filename) == expected);
+    assert(remove(filename) == 0);
+}
+
+void test_sync() {
+    const char* const filename = "test_sync.txt";
+    {
+        stdext::async_filebuf buf;
+        assert(buf.open(filename, ios::out | ios::binary, 64, 3) == &buf);
+        ostream os(&buf);
+
+        os << "hello";
+        assert(os.flush().good());
+        assert(read_file(filename) == "hello"); // flushing waits for the writer thread
+
+        os << ", world";
+    } // the destructor writes the rest
+
+    assert(read_file(filename) == "hello, world");
+    assert(remove(filename) == 0);
+}
+
+void test_open_failures() {
+    stdext::async_filebuf buf;
+    assert(buf.open("test_open_failures.txt", ios::in) == nullptr);
+    assert(buf.open("test_open_failures.txt", ios::out, 16, 1) == nullptr); // at least two buffers are needed
+    assert(!buf.is_open());
+    assert(buf.pubsync() == 0);
+    assert(buf.sputc('x') == char_traits<char>::eof());
+
+    assert(buf.open(L"test_open_failures.txt") == &buf);
+    assert(buf.open(L"test_open_failures.txt") == nullptr); // already open
+    assert(buf.close() == &buf);
+    assert(read_file("test_open_failures.txt").empty());
+    assert(remove("test_open_failures.txt") == 0);
+}
+
+void test_append() {
+    const char* const filename = "test_append.txt";
+    {
+        ofstream file(filename, ios::binary);
+        file << "first ";
+    }
+
+    {
+        stdext::async_filebuf buf;
+        assert(buf.open(filename, ios::app | ios::binary) == &buf);
+        ostream os(&buf);
+        os << "second";
+    }
+
+    assert(read_file(filename) == "first second");
+    assert(remove(filename) == 0);
+}
+
+void test_destroy_without_close() {
+    // the destructor lets each writer thread exit on its own; later buffers must still see all the data
+    const char* const filename = "test_destroy_without_close.txt";
+    string expected;
+    for (int i = 0; i < 100; ++i) {
+        {
+            stdext::async_filebuf buf;
+            assert(buf.open(filename, ios::app | ios::binary, 16, 2) == &buf);
+            ostream os(&buf);
+            const string text = "pass " + to_string(i) + " of many buffers\n";
+            os << text;
+            expected += text;
+        }
+
+        assert(read_file(filename) == expected);
+    }
+
+    assert(remove(filename) == 0);
+}
+
+vector<DWORD> thread_ids() {
+    vector<DWORD> ids;
+    const HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+    assert(snapshot != INVALID_HANDLE_VALUE);
+    THREADENTRY32 entry{};
+    entry.dwSize = sizeof(entry);
+    for (BOOL more = Thread32First(snapshot, &entry); more; more = Thread32Next(snapshot, &entry)) {
+        if (entry.th32OwnerProcessID == GetCurrentProcessId()) {
+            ids.push_back(entry.th32ThreadID);
+        }
+    }
+
+    CloseHandle(snapshot);
+    return ids;
+}
+
+void test_destroy_after_writer_terminated() {
+    // as after ExitProcess: the writer thread is gone while writing, holding the FILE's lock; the destructor must
+    // neither write nor close the file, which would wait for that lock forever
+    const wchar_t* const pipe_name = L"\\\\.\\pipe\\test_destroy_after_writer_terminated";
+    const HANDLE pipe =
+        CreateNamedPipeW(pipe_name, PIPE_ACCESS_INBOUND, PIPE_TYPE_BYTE | PIPE_WAIT, 1, 0, 16, 0, nullptr);
+    assert(pipe != INVALID_HANDLE_VALUE);
+
+    {
+        const vector<DWORD> old_threads = thread_ids();
+        stdext::async_filebuf buf;
+        assert(buf.open(pipe_name, ios::out | ios::binary, 0x1000, 2) == &buf);
+        DWORD writer_id = 0;
+        for (const DWORD id : thread_ids()) {
+            if (find(old_threads.begin(), old_threads.end(), id) == old_threads.end()) {
+                writer_id = id;
+            }
+        }
+
+        assert(writer_id != 0);
+        const HANDLE writer = OpenThread(THREAD_TERMINATE | SYNCHRONIZE, FALSE, writer_id);
+        assert(writer != nullptr);
+
+        // nothing reads the pipe, so once some bytes are in it, the writer thread is blocked in fwrite
+        const string text(0x1800, 'x');
+        assert(buf.sputn(text.data(), static_cast<streamsize>(text.size())) == static_cast<streamsize>(text.size()));
+        for (DWORD available = 0; available == 0; Sleep(1)) {
+            assert(PeekNamedPipe(pipe, nullptr, 0, nullptr, &available, nullptr));
+        }
+
+        assert(TerminateThread(writer, 0));
+        assert(WaitForSingleObject(writer, INFINITE) == WAIT_OBJECT_0);
+        CloseHandle(writer);
+    } // the FILE and the writer are leaked
+
+    CloseHandle(pipe);
+}
+#endif // !defined(_M_CEE_PURE)
+
+int main() {
+#ifndef _M_CEE_PURE
+    test_write_and_close();
+    test_sync();
+    test_open_failures();
+    test_append();
+    test_destroy_without_close();
+    test_destroy_after_writer_terminated();
+#endif // !defined(_M_CEE_PURE)
+}
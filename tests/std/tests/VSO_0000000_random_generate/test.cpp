@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "test_vector_algorithms_support.hpp"
+
+using namespace std;
+
+template <class Engine, class Dist, class Container>
+void test_generate_random_distribution_case(mt19937_64& gen, Dist dist, Container& values) {
+    const auto seed = static_cast<typename Engine::result_type>(gen());
+    Engine engine(seed);
+    Engine bulk(seed);
+
+    for (int round = 0; round < 4; ++round) {
+        values.resize(uniform_int_distribution<size_t>{0, 700}(gen));
+        stdext::generate_random(values.begin(), values.end(), bulk, dist);
+        for (const auto& value : values) {
+            assert(value == dist(engine));
+        }
+
+        assert(engine == bulk);
+    }
+}
+
+template <class Engine>
+void test_generate_random_distributions(mt19937_64& gen) {
+    vector<int> ints;
+    test_generate_random_distribution_case<Engine>(gen, uniform_int_distribution<int>{0, 5}, ints);
+    test_generate_random_distribution_case<Engine>(gen, uniform_int_distribution<int>{-3, 1'000'000'007}, ints);
+    test_generate_random_distribution_case<Engine>(gen, uniform_int_distribution<int>{}, ints);
+
+    list<long long> long_longs; // not contiguous
+    test_generate_random_distribution_case<Engine>(gen, uniform_int_distribution<long long>{0, 1LL << 40}, long_longs);
+
+    vector<unsigned long long> ulls;
+    test_generate_random_distribution_case<Engine>(
+        gen, uniform_int_distribution<unsigned long long>{0, (1ULL << 63) + 12345}, ulls);
+
+    vector<float> floats;
+    test_generate_random_distribution_case<Engine>(gen, uniform_real_distribution<float>{-1.0f, 2.0f}, floats);
+
+    vector<double> doubles;
+    test_generate_random_distribution_case<Engine>(gen, uniform_real_distribution<double>{0.0, 1.0}, doubles);
+    test_generate_random_distribution_case<Engine>(gen, exponential_distribution<double>{2.0}, doubles);
+
+    deque<bool> bools;
+    test_generate_random_distribution_case<Engine>(gen, bernoulli_distribution{0.3}, bools);
+
+    {
+        // normal_distribution keeps the second value of each pair, so it must be called through the same object
+        normal_distribution<double> dist;
+        normal_distribution<double> bulk_dist;
+        Engine engine;
+        Engine bulk;
+        doubles.resize(101);
+        stdext::generate_random(doubles.begin(), doubles.end(), bulk, bulk_dist);
+        for (const auto& value : doubles) {
+            assert(value == dist(engine));
+        }
+
+        assert(engine == bulk);
+    }
+}
+
+int main() {
+    run_randomized_tests_with_different_isa_levels([](mt19937_64& gen) {
+        test_generate_random_distributions<mt19937>(gen);
+        test_generate_random_distributions<mt19937_64>(gen);
+        test_generate_random_distributions<minstd_rand>(gen);
+    });
+}
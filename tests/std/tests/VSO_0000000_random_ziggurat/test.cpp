@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+template <class Dist>
+void test_ziggurat_param_behavior(const Dist& dist, const typename Dist::param_type& other_params) {
+    Dist copy(dist);
+    assert(copy == dist);
+    copy.param(other_params);
+    assert(copy.param() == other_params);
+    assert(copy == Dist(other_params));
+    assert(copy != dist);
+
+    std::stringstream ss;
+    ss << dist;
+    ss >> copy;
+    assert(copy == dist);
+}
+
+void test_ziggurat() {
+    // stdext::ziggurat_normal_distribution and stdext::ziggurat_exponential_distribution sample the same
+    // distributions as normal_distribution and exponential_distribution, including the layers' tails and wedges
+    constexpr int iters{1'000'000};
+    std::mt19937_64 gen(12345);
+
+    {
+        stdext::ziggurat_normal_distribution<double> dist(5.0, 2.0);
+        double sum{0.0};
+        double sum_sq{0.0};
+        int beyond_two_sigma{0};
+        for (int i = 0; i < iters; ++i) {
+            const double x{dist(gen)};
+            sum += x;
+            sum_sq += (x - 5.0) * (x - 5.0);
+            if (std::abs(x - 5.0) > 4.0) {
+                ++beyond_two_sigma;
+            }
+        }
+
+        assert(std::abs(sum / iters - 5.0) < 0.01);
+        assert(std::abs(sum_sq / iters / 4.0 - 1.0) < 0.02);
+        assert(std::abs(beyond_two_sigma / (iters * 0.04550026389635842) - 1.0) < 0.05);
+
+        test_ziggurat_param_behavior(dist, decltype(dist)::param_type{-1.0, 0.25});
+        assert(dist.mean() == 5.0 && dist.stddev() == 2.0);
+    }
+
+    {
+        stdext::ziggurat_exponential_distribution<double> dist(0.5);
+        double sum{0.0};
+        double sum_sq{0.0};
+        int beyond_ten{0};
+        for (int i = 0; i < iters; ++i) {
+            const double x{dist(gen)};
+            assert(x >= 0.0);
+            sum += x;
+            sum_sq += (x - 2.0) * (x - 2.0);
+            if (x > 10.0) {
+                ++beyond_ten;
+            }
+        }
+
+        assert(std::abs(sum / iters - 2.0) < 0.01);
+        assert(std::abs(sum_sq / iters / 4.0 - 1.0) < 0.02);
+        assert(std::abs(beyond_ten / (iters * std::exp(-5.0)) - 1.0) < 0.05);
+
+        test_ziggurat_param_behavior(dist, decltype(dist)::param_type{3.0});
+        assert(dist.lambda() == 0.5);
+    }
+
+    {
+        std::minstd_rand narrow_gen; // fewer than 64 bits per call
+        stdext::ziggurat_normal_distribution<float> normal_dist;
+        stdext::ziggurat_exponential_distribution<float> exponential_dist;
+        for (int i = 0; i < 1000; ++i) {
+            assert(std::isfinite(normal_dist(narrow_gen)));
+            assert(exponential_dist(narrow_gen) >= 0.0f);
+        }
+    }
+}
+
+int main() {
+    test_ziggurat();
+}
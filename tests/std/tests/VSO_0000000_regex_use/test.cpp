@@ -2129,6 +2129,251 @@ void test_gh_5672() {
     }
 }
 
+void test_required_literal_prefilter() {
+    // regex_search looks for a literal that every match must contain to skip over hopeless starting positions.
+    {
+        test_regex literal_after_class(&g_regexTester, R"(\w\w bibe)");
+        literal_after_class.should_search_match("lorem ipsum ab bibendum", "ab bibe");
+        literal_after_class.should_search_match("x bibe yz bibe", "yz bibe");
+        literal_after_class.should_search_fail("lorem ipsum bibendum");
+        literal_after_class.should_search_fail("ab bib");
+        literal_after_class.should_search_fail("");
+    }
+    {
+        test_regex literal_after_rep(&g_regexTester, R"([a-z]+ ERROR)");
+        literal_after_rep.should_search_match("10:00 host ERROR reset", "host ERROR");
+        literal_after_rep.should_search_match("ERROR ERROR x ERROR", "x ERROR");
+        literal_after_rep.should_search_fail("10:00 host INFO ok");
+        literal_after_rep.should_search_fail("10:00 HOST ERROR");
+    }
+    {
+        // literals in alternatives and optional parts aren't required
+        test_regex alternatives(&g_regexTester, R"((?:abc|xy)z(?:defgh)?)");
+        alternatives.should_search_match("--xyz--", "xyz");
+        alternatives.should_search_match("--abczdefgh", "abczdefgh");
+        alternatives.should_search_fail("--abdefgh");
+
+        test_regex optional(&g_regexTester, R"(a(?:longer)*b)");
+        optional.should_search_match("xxab", "ab");
+        optional.should_search_match("xxalongerlongerb", "alongerlongerb");
+    }
+    {
+        // the literal must be found case-insensitively
+        test_regex icase_literal(&g_regexTester, R"(\d+ error)", ECMAScript | icase);
+        icase_literal.should_search_match("code 42 ERROR", "42 ERROR");
+        icase_literal.should_search_fail("code 42 failure");
+    }
+    {
+        // the literal can be inside a lookahead assertion
+        test_regex lookahead(&g_regexTester, R"(\w(?=bc))");
+        lookahead.should_search_match("aabc", "a");
+        lookahead.should_search_fail("aab");
+    }
+    {
+        // the matched prefix must be reported correctly after skipping
+        const regex re(R"(\w\w\w-\d\d)");
+        const string subject = "xxxxxxxxxx abc-1 def-23 ghi";
+        smatch m;
+        assert(regex_search(subject, m, re));
+        assert(m[0] == "def-23");
+        assert(m.prefix() == "xxxxxxxxxx abc-1 ");
+        assert(m.suffix() == " ghi");
+
+        const string no_match = "nothing here";
+        assert(!regex_search(no_match, m, re));
+        assert(m.ready());
+        assert(m.empty());
+    }
+    {
+        // with match_continuous, only the start of the target is tried
+        const regex re(R"(\w\w bibe)");
+        assert(regex_search("ab bibendum", re, regex_constants::match_continuous));
+        assert(!regex_search("xab bibendum", re, regex_constants::match_continuous));
+        assert(!regex_search("x", re, regex_constants::match_continuous));
+
+        cmatch m;
+        assert(regex_search("ab bibe ab bibe", m, re, regex_constants::match_continuous));
+        assert(m.position(0) == 0);
+        assert(!regex_search("- ab bibe", m, re, regex_constants::match_continuous));
+    }
+}
+
+void test_automaton_without_submatches() {
+    // regex_match and regex_search without match_results simulate the nfa in linear time when they can
+    {
+        // exponential for a backtracking matcher
+        const string subject(100, 'a');
+        const regex alternation_loop("(a|aa)*b");
+        assert(!regex_match(subject, alternation_loop));
+        assert(!regex_search(subject, alternation_loop));
+        assert(regex_match(subject + "b", alternation_loop));
+        assert(regex_search(subject + "b", alternation_loop));
+
+        const regex nested_loops("(a*)*c");
+        assert(!regex_search(subject, nested_loops));
+        assert(regex_search(subject + "c", nested_loops));
+    }
+
+    g_regexTester.should_match("abcabcabc", "(abc)+");
+    g_regexTester.should_not_match("abcabcab", "(abc)+");
+    g_regexTester.should_match("", "(abc)*");
+    g_regexTester.should_match("ab", "a(x|y)?b");
+    g_regexTester.should_match("axb", "a(x|y)?b");
+    g_regexTester.should_not_match("axyb", "a(x|y)?b");
+    g_regexTester.should_match("x.y.z", R"(\w(\.\w)*)");
+    g_regexTester.should_match("a\nb", "a[^x]b");
+    g_regexTester.should_not_match("a\nb", "a.*b");
+    g_regexTester.should_match("ABCabc", "(abc)+", ECMAScript | icase);
+    g_regexTester.should_match("aaa", "a*", basic);
+    g_regexTester.should_match("abab", "(ab)*", extended);
+    g_regexTester.should_not_match("aba", "(ab)*", extended);
+
+    {
+        // anchors and word boundaries are checked between characters
+        const regex anchors("^ab+$");
+        assert(regex_search("abbb", anchors));
+        assert(!regex_search("xabbb", anchors));
+        assert(!regex_search("abbb", anchors, regex_constants::match_not_bol));
+        assert(!regex_search("abbb", anchors, regex_constants::match_not_eol));
+
+        const regex multiline_anchors("^ab+$", ECMAScript | regex_constants::multiline);
+        assert(regex_search("x\nabb\ny", multiline_anchors));
+        assert(!regex_search("x\nabbc\ny", multiline_anchors));
+
+        const regex words(R"(\bcat\w*\b)");
+        assert(regex_search("the catalog", words));
+        assert(!regex_search("concatenate", words));
+
+        const regex non_word(R"(a+\B)");
+        assert(regex_search("aab", non_word));
+        assert(!regex_search("aa b", non_word));
+    }
+
+    {
+        // match_continuous anchors the search at the beginning
+        const regex re("b+");
+        assert(regex_search("bbb", re, regex_constants::match_continuous));
+        assert(!regex_search("abbb", re, regex_constants::match_continuous));
+        assert(regex_search("abbb", re));
+    }
+
+    {
+        // the result must agree with the backtracking matcher
+        const char* const patterns[] = {"a(b|c)*d", "(x+x+)+y", "[a-c]+[^a-c]", ".*q", "(a|ab)(c|bcd)d*"};
+        const char* const subjects[] = {"", "ad", "abcbcd", "abce", "xxxxy", "xxxx", "cab", "abc", "zzq", "z\nq", "abcd"};
+        for (const auto& pattern : patterns) {
+            const regex re(pattern);
+            for (const auto& subject : subjects) {
+                cmatch m;
+                assert(regex_match(subject, re) == regex_match(subject, m, re));
+                assert(regex_search(subject, re) == regex_search(subject, m, re));
+            }
+        }
+    }
+
+    {
+        // the automaton is built on first use, then kept with the nfa, which copies share
+        regex re("(a|b)*c");
+        const regex copy = re;
+        for (int i = 0; i < 3; ++i) {
+            assert(regex_match("abac", re));
+            assert(regex_match("abac", copy));
+            assert(!regex_search("abab", copy));
+        }
+
+        re.assign("(x|y)*z");
+        assert(regex_match("xyz", re));
+        assert(!regex_match("abac", re));
+        assert(regex_match("abac", copy));
+    }
+}
+
+void test_regex_replace_reuses_match_state() {
+    // regex_replace reuses the matcher's buffers from one match to the next;
+    // capture groups and loop state must not leak into later matches
+    g_regexTester.should_replace_to("abba", "(a)|(b)", "[$1|$2]", format_default, "[a|][|b][|b][a|]");
+    g_regexTester.should_replace_to("xyyx-x", "(x)(y*)", "<$1$2>", format_default, "<xyy><x>-<x>");
+    g_regexTester.should_replace_to("aXbbY", "(?:(a)|(b))+([XY])", "{$1,$2,$3}", format_default, "{a,,X}{,b,Y}");
+    g_regexTester.should_replace_to("abcabc", "(?:a|(b)|c)", "$1", format_default, "bb");
+
+    // regex_iterator borrows the buffers cached by the regex on each increment; iterators of different types
+    // and iterators advanced in turn over the same regex must not see each other's state
+    const regex re("(?:(a)|(b))+([XY])");
+    const string text = "aXbbYaaX";
+    const regex copy  = re;
+    sregex_iterator first(text.begin(), text.end(), re);
+    cregex_iterator second(text.c_str(), text.c_str() + text.size(), copy);
+    const cregex_iterator last;
+    const char* const expected[][3] = {{"a", "", "X"}, {"", "b", "Y"}, {"a", "", "X"}};
+    for (const auto& groups : expected) {
+        assert(first != sregex_iterator{});
+        assert(second != last);
+        for (size_t group = 0; group < 3; ++group) {
+            assert(first->str(group + 1) == groups[group]);
+            assert(second->str(group + 1) == groups[group]);
+        }
+
+        ++first;
+        ++second;
+    }
+
+    assert(first == sregex_iterator{});
+    assert(second == last);
+
+    // a default-constructed regex has no nfa to cache buffers in, and matches nothing
+    const regex empty_re;
+    assert(sregex_iterator(text.begin(), text.end(), empty_re) == sregex_iterator{});
+    assert(cregex_iterator(text.c_str(), text.c_str() + text.size(), empty_re) == last);
+}
+
+void test_class_run_backoff() {
+    // a greedy loop over a bracket expression takes the whole run and gives characters back until the tail matches
+    const string long_run(100, 'x');
+    {
+        test_regex short_runs(&g_regexTester, "[a-c]*b");
+        short_runs.should_search_match("abcabc!", "abcab");
+        short_runs.should_search_match("cb", "cb");
+        short_runs.should_search_fail("acca");
+
+        test_regex alnum_run(&g_regexTester, "[a-z0-9]+c");
+        alnum_run.should_search_match("ab123c", "ab123c");
+        alnum_run.should_search_fail("ab123d");
+    }
+    {
+        // runs long enough to be scanned with vector instructions
+        test_regex lower_run(&g_regexTester, "[a-z]+xx-");
+        lower_run.should_search_match("--" + long_run + "x--", long_run + "x-");
+        lower_run.should_search_fail("--" + long_run + "y--");
+
+        test_regex negated_run(&g_regexTester, "[^a]+a");
+        negated_run.should_search_match(long_run + "a" + long_run, long_run + "a");
+
+        test_regex negated_backoff(&g_regexTester, "[^-]*x");
+        negated_backoff.should_search_match("--" + long_run + "--", long_run);
+
+        test_regex named_class(&g_regexTester, R"([[:lower:]]*xZ)");
+        named_class.should_search_match("ab" + long_run + "Z", "ab" + long_run + "Z");
+
+        test_regex icase_run(&g_regexTester, "[a-z]+q", ECMAScript | icase);
+        icase_run.should_search_match("ABxx" + long_run + "Q", "ABxx" + long_run + "Q");
+    }
+    {
+        // capture groups around and after the loop
+        test_regex groups(&g_regexTester, "([a]*)(a)b");
+        groups.should_search_match_capture_groups("aaab", "aaab", match_default, {{0, 2}, {2, 3}});
+    }
+    {
+        const wstring wide = L"\x3b1\x3b2" + wstring(100, L'x') + L"\x3b3;";
+        wsmatch m;
+        assert(regex_search(wide, m, wregex(L"[^;]+;")));
+        assert(m[0] == wide);
+        assert(regex_search(wide, m, wregex(L"[x]+\x3b3")));
+        assert(m[0].length() == 101);
+        assert(regex_search(wide, m, wregex(L"[x\x3b1\x3b2]*;")));
+        assert(m[0] == L";");
+    }
+}
+
 int main() {
     test_dev10_449367_case_insensitivity_should_work();
     test_dev11_462743_regex_collate_should_not_disable_regex_icase();
@@ -2180,6 +2425,10 @@ int main() {
     test_gh_5509();
     test_gh_5576();
     test_gh_5672();
+    test_required_literal_prefilter();
+    test_automaton_without_submatches();
+    test_regex_replace_reuses_match_state();
+    test_class_run_backoff();
 
     return g_regexTester.result();
 }
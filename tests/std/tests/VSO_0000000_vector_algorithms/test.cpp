@@ -1,11 +1,15 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CODECVT_CHAR8_T_FACETS_DEPRECATION_WARNING
+
 #include <algorithm>
 #include <array>
 #include <bitset>
 #include <cassert>
 #include <climits>
+#include <codecvt>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -13,8 +17,10 @@
 #include <functional>
 #include <limits>
 #include <list>
+#include <locale>
 #include <numeric>
 #include <random>
+#include <regex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -1367,6 +1373,65 @@ void test_randomized_bitset_base_count(mt19937_64& gen) {
     test_randomized_bitset_base<Base>(make_index_sequence<Count>{}, gen);
 }
 
+template <size_t N>
+bitset<N> random_bitset(mt19937_64& gen) {
+    bitset<N> b;
+    const auto density = gen() % 4; // also produce all ones and all zeros
+    for (size_t i = 0; i != N; ++i) {
+        b[i] = density == 0 || (density != 1 && gen() % density == 0);
+    }
+
+    return b;
+}
+
+template <size_t N>
+void test_randomized_bitset_words(mt19937_64& gen) {
+    for (int iteration = 0; iteration != 4; ++iteration) {
+        const bitset<N> left  = random_bitset<N>(gen);
+        const bitset<N> right = random_bitset<N>(gen);
+
+        const bitset<N> anded = left & right;
+        const bitset<N> ored  = left | right;
+        const bitset<N> xored = left ^ right;
+
+        size_t expected_count = 0;
+        for (size_t i = 0; i != N; ++i) {
+            assert(anded[i] == (left[i] && right[i]));
+            assert(ored[i] == (left[i] || right[i]));
+            assert(xored[i] == (left[i] != right[i]));
+            expected_count += left[i];
+        }
+
+        assert(left.count() == expected_count);
+        assert(left.any() == (expected_count != 0));
+        assert(left.none() == (expected_count == 0));
+        assert(left.all() == (expected_count == N));
+
+        const size_t shifts[] = {0, 1, 63, 64, 65, 128, 200, N - 1, N, N + 1, static_cast<size_t>(gen() % N)};
+        for (const size_t shift : shifts) {
+            const bitset<N> shifted_left  = left << shift;
+            const bitset<N> shifted_right = left >> shift;
+            for (size_t i = 0; i != N; ++i) {
+                assert(shifted_left[i] == (i >= shift && left[i - shift]));
+                assert(shifted_right[i] == (shift < N - i && left[i + shift]));
+            }
+        }
+
+        vector<size_t> positions;
+        stdext::for_each_set_bit(left, [&](const size_t pos) { positions.push_back(pos); });
+        assert(positions.size() == expected_count);
+
+        size_t pos = stdext::find_next_set_bit(left, 0);
+        for (const size_t expected : positions) {
+            assert(pos == expected);
+            assert(left[pos]);
+            pos = stdext::find_next_set_bit(left, pos + 1);
+        }
+
+        assert(pos == N);
+    }
+}
+
 template <class F>
 void assert_throws_inv(F f) {
     try {
@@ -1445,6 +1510,15 @@ void test_bitset(mt19937_64& gen) {
            == 0xFEDCBA9876543210ULL); // not vectorized
 
     test_randomized_bitset_base_count<512 - 5, 32 + 10>(gen);
+
+    test_randomized_bitset_words<100>(gen);
+    test_randomized_bitset_words<256>(gen);
+    test_randomized_bitset_words<257>(gen);
+    test_randomized_bitset_words<511>(gen);
+    test_randomized_bitset_words<512>(gen);
+    test_randomized_bitset_words<1000>(gen);
+    test_randomized_bitset_words<4096>(gen);
+    test_randomized_bitset_words<4159>(gen);
 }
 
 template <class T>
@@ -1708,6 +1782,10 @@ void test_basic_string(mt19937_64& gen) {
         uniform_int_distribution<dis_int_type> dis_greek(0x391, 0x3C9);
         test_basic_string_dis<T>(gen, dis_greek);
     }
+    if constexpr (sizeof(T) == 4) { // beyond what the bitmap handles
+        uniform_int_distribution<dis_int_type> dis_emoji(0x1F600, 0x1F64F);
+        test_basic_string_dis<T>(gen, dis_emoji);
+    }
 }
 
 // GH-5757 <string>: wstring::find_first_of crashes on some inputs
@@ -1743,6 +1821,328 @@ void test_string(mt19937_64& gen) {
     test_gh_5757_find_first_of();
 }
 
+char last_known_good_ascii_tolower(const char c) {
+    return 'A' <= c && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+char last_known_good_ascii_toupper(const char c) {
+    return 'a' <= c && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+}
+
+size_t last_known_good_ascii_icase_search(const string& haystack, const string& needle) {
+    for (size_t pos = 0; pos + needle.size() <= haystack.size(); ++pos) {
+        if (equal(needle.begin(), needle.end(), haystack.begin() + static_cast<ptrdiff_t>(pos), [](char n, char h) {
+                return last_known_good_ascii_tolower(n) == last_known_good_ascii_tolower(h);
+            })) {
+            return pos;
+        }
+    }
+
+    return string::npos;
+}
+
+void test_ascii_case(mt19937_64& gen) {
+    const auto& facet = use_facet<ctype<char>>(locale::classic());
+    uniform_int_distribution<int> dis_byte(-128, 127);
+    uniform_int_distribution<int> dis_letter('a', 'd');
+    bernoulli_distribution dis_upper(0.5);
+
+    const auto random_case = [&](const char c) {
+        return dis_upper(gen) ? last_known_good_ascii_toupper(c) : c;
+    };
+
+    string input;
+    string temp;
+    input.reserve(dataCount);
+    temp.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<char>(dis_byte(gen)));
+
+        temp = input;
+        facet.tolower(temp.data(), temp.data() + temp.size());
+        assert(equal(temp.begin(), temp.end(), input.begin(), input.end(),
+            [](char t, char i) { return t == last_known_good_ascii_tolower(i); }));
+
+        temp = input;
+        facet.toupper(temp.data(), temp.data() + temp.size());
+        assert(equal(temp.begin(), temp.end(), input.begin(), input.end(),
+            [](char t, char i) { return t == last_known_good_ascii_toupper(i); }));
+    }
+
+    // regex literals and backreferences are compared ignoring case, and searched for ignoring case
+    string haystack;
+    string needle;
+    haystack.reserve(dataCount);
+    needle.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount / 16; ++attempts) {
+        for (size_t i = 0; i < 16; ++i) {
+            haystack.push_back(random_case(static_cast<char>(dis_letter(gen))));
+        }
+
+        for (size_t needle_len = 0; needle_len < 40 && needle_len <= haystack.size(); needle_len += 3) {
+            needle.resize(needle_len);
+            for (auto& c : needle) {
+                c = random_case(static_cast<char>(dis_letter(gen)));
+            }
+
+            if (needle_len != 0 && dis_upper(gen)) { // plant a copy, in another case
+                const auto pos = static_cast<ptrdiff_t>(haystack.size() - needle_len) / 2;
+                transform(haystack.begin() + pos, haystack.begin() + pos + static_cast<ptrdiff_t>(needle_len),
+                    needle.begin(), random_case);
+            }
+
+            // string::const_iterator and const char* both reach __std_search_ascii_icase_left
+            const regex re(needle, regex::icase);
+            smatch match;
+            cmatch pointer_match;
+            const size_t expected = last_known_good_ascii_icase_search(haystack, needle);
+            if (expected == string::npos) {
+                assert(!regex_search(haystack, match, re));
+                assert(!regex_search(haystack.c_str(), pointer_match, re));
+            } else {
+                assert(regex_search(haystack, match, re));
+                assert(static_cast<size_t>(match.position(0)) == expected);
+                assert(regex_search(haystack.c_str(), pointer_match, re));
+                assert(static_cast<size_t>(pointer_match.position(0)) == expected);
+            }
+
+            string doubled = needle;
+            for (const char c : needle) {
+                doubled.push_back(random_case(c));
+            }
+
+            assert(regex_match(doubled, regex{"(.*)\\1", regex::icase}));
+            if (needle_len != 0) {
+                doubled.back() = 'e';
+                assert(!regex_match(doubled, regex{"(.*)\\1", regex::icase}));
+            }
+        }
+    }
+}
+
+void last_known_good_append_utf8(string& str, const char32_t code_point) {
+    if (code_point < 0x80) {
+        str.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        str.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        str.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        str.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        str.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        str.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        str.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        str.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        str.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        str.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+void last_known_good_append_utf16(u16string& str, const char32_t code_point) {
+    if (code_point < 0x10000) {
+        str.push_back(static_cast<char16_t>(code_point));
+    } else {
+        str.push_back(static_cast<char16_t>(0xD800 | ((code_point - 0x10000) >> 10)));
+        str.push_back(static_cast<char16_t>(0xDC00 | (code_point & 0x3FF)));
+    }
+}
+
+template <class Facet>
+void test_utf_conversions(const Facet& facet, const u16string& utf16, const string& utf8, const size_t utf16_before,
+    const size_t utf8_before) {
+    // the last code point begins at utf16[utf16_before] and utf8[utf8_before]
+    using Byte = typename Facet::extern_type;
+    const basic_string<Byte> bytes(utf8.begin(), utf8.end());
+    const Byte* from_next_bytes;
+    const char16_t* from_next_wide;
+    Byte* to_next_bytes;
+    char16_t* to_next_wide;
+
+    u16string wide(utf16.size(), u'\0');
+    mbstate_t state{};
+    assert(facet.in(state, bytes.data(), bytes.data() + bytes.size(), from_next_bytes, &wide[0], &wide[0] + wide.size(),
+               to_next_wide)
+           == codecvt_base::ok);
+    assert(from_next_bytes == bytes.data() + bytes.size());
+    assert(to_next_wide == wide.data() + wide.size());
+    assert(wide == utf16);
+
+    basic_string<Byte> narrow(utf8.size(), Byte{});
+    state = mbstate_t{};
+    assert(facet.out(state, utf16.data(), utf16.data() + utf16.size(), from_next_wide, &narrow[0],
+               &narrow[0] + narrow.size(), to_next_bytes)
+           == codecvt_base::ok);
+    assert(from_next_wide == utf16.data() + utf16.size());
+    assert(to_next_bytes == narrow.data() + narrow.size());
+    assert(narrow == bytes);
+
+    // a stray trailing byte stops the conversion of UTF-8 after the code points before it
+    basic_string<Byte> invalid_bytes = bytes;
+    invalid_bytes.insert(invalid_bytes.begin() + static_cast<ptrdiff_t>(utf8_before), static_cast<Byte>(0x80));
+    wide.assign(utf16.size(), u'\0');
+    state = mbstate_t{};
+    assert(facet.in(state, invalid_bytes.data(), invalid_bytes.data() + invalid_bytes.size(), from_next_bytes,
+               &wide[0], &wide[0] + wide.size(), to_next_wide)
+           == codecvt_base::error);
+    assert(to_next_wide == wide.data() + utf16_before);
+    assert(equal(wide.data(), to_next_wide, utf16.begin()));
+}
+
+#ifdef __cpp_lib_char8_t
+void test_unpaired_surrogate(
+    const u16string& utf16, const string& utf8, const size_t utf16_before, const size_t utf8_before) {
+    // an unpaired high surrogate stops the conversion of UTF-16 after the code points before it
+    const auto& facet      = use_facet<codecvt<char16_t, char8_t, mbstate_t>>(locale::classic());
+    u16string invalid_wide = utf16;
+    invalid_wide.insert(invalid_wide.begin() + static_cast<ptrdiff_t>(utf16_before), u'\xD800');
+    u8string narrow(utf8.size() + 3, char8_t{});
+    const char16_t* from_next;
+    char8_t* to_next;
+    mbstate_t state{};
+    assert(facet.out(state, invalid_wide.data(), invalid_wide.data() + invalid_wide.size(), from_next, &narrow[0],
+               &narrow[0] + narrow.size(), to_next)
+           == codecvt_base::error);
+    assert(from_next == invalid_wide.data() + utf16_before);
+    assert(to_next == narrow.data() + utf8_before);
+    assert(equal(narrow.data(), to_next, utf8.begin(), [](char8_t n, char c) { return n == static_cast<char8_t>(c); }));
+}
+#endif // __cpp_lib_char8_t
+
+void test_utf_transcoding(mt19937_64& gen) {
+    const codecvt_utf8_utf16<char16_t> utf8_utf16_facet;
+    uniform_int_distribution<int> dis_kind(0, 3);
+    uniform_int_distribution<int> dis_same_kind(0, 7);
+    uniform_int_distribution<unsigned int> dis_ascii(0, 0x7F);
+    uniform_int_distribution<unsigned int> dis_two_bytes(0x80, 0x7FF);
+    uniform_int_distribution<unsigned int> dis_three_bytes(0x800, 0xFFFF);
+    uniform_int_distribution<unsigned int> dis_four_bytes(0x10000, 0x10FFFF);
+
+    // runs of ASCII, Latin, CJK and supplementary code points, so that every vectorized step is taken
+    u16string utf16;
+    string utf8;
+    utf16.reserve(dataCount * 2);
+    utf8.reserve(dataCount * 4);
+    int kind = 0;
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        if (dis_same_kind(gen) == 0) {
+            kind = dis_kind(gen);
+        }
+
+        char32_t code_point;
+        switch (kind) {
+        case 0:
+            code_point = dis_ascii(gen);
+            break;
+        case 1:
+            code_point = dis_two_bytes(gen);
+            break;
+        case 2:
+            code_point = dis_three_bytes(gen);
+            if (code_point >= 0xD800 && code_point < 0xE000) { // not a surrogate
+                code_point ^= 0x1000;
+            }
+            break;
+        default:
+            code_point = dis_four_bytes(gen);
+            break;
+        }
+
+        const size_t utf16_before = utf16.size();
+        const size_t utf8_before  = utf8.size();
+        last_known_good_append_utf16(utf16, code_point);
+        last_known_good_append_utf8(utf8, code_point);
+
+        test_utf_conversions(utf8_utf16_facet, utf16, utf8, utf16_before, utf8_before);
+#ifdef __cpp_lib_char8_t
+        const auto& char8_t_facet = use_facet<codecvt<char16_t, char8_t, mbstate_t>>(locale::classic());
+        test_utf_conversions(char8_t_facet, utf16, utf8, utf16_before, utf8_before);
+        test_unpaired_surrogate(utf16, utf8, utf16_before, utf8_before);
+#endif // __cpp_lib_char8_t
+    }
+}
+
+template <class UInt, size_t W, size_t N, size_t M, size_t R, UInt A, size_t U, UInt D, size_t S, UInt B, size_t T,
+    UInt C, size_t L, UInt F>
+class last_known_good_mersenne_twister { // N4950 [rand.eng.mers], one state word at a time
+public:
+    explicit last_known_good_mersenne_twister(const UInt seed) {
+        x[0] = seed & word_mask;
+        for (size_t k = 1; k < N; ++k) {
+            x[k] = static_cast<UInt>(F * (x[k - 1] ^ (x[k - 1] >> (W - 2))) + k) & word_mask;
+        }
+    }
+
+    UInt operator()() {
+        const UInt upper = static_cast<UInt>(word_mask << R) & word_mask;
+        const UInt y     = (x[i] & upper) | (x[(i + 1) % N] & ~upper & word_mask);
+        x[i]             = x[(i + M) % N] ^ (y >> 1) ^ ((y & 1) != 0 ? A : UInt{0});
+
+        UInt z = x[i];
+        i      = (i + 1) % N;
+        z ^= (z >> U) & D;
+        z ^= (z << S) & B;
+        z ^= (z << T) & C;
+        z ^= z >> L;
+        return z;
+    }
+
+private:
+    static constexpr UInt word_mask = static_cast<UInt>(~UInt{0} >> (numeric_limits<UInt>::digits - W));
+
+    UInt x[N];
+    size_t i = 0;
+};
+
+template <class UInt, size_t W, size_t N, size_t M, size_t R, UInt A, size_t U, UInt D, size_t S, UInt B, size_t T,
+    UInt C, size_t L, UInt F>
+void test_mersenne_twister_params(mt19937_64& gen) {
+    using Engine    = mersenne_twister_engine<UInt, W, N, M, R, A, U, D, S, B, T, C, L, F>;
+    using Reference = last_known_good_mersenne_twister<UInt, W, N, M, R, A, U, D, S, B, T, C, L, F>;
+
+    const auto seed = static_cast<UInt>(gen());
+    Engine engine(seed);
+    Engine bulk(seed);
+    Reference reference(seed);
+
+    uniform_int_distribution<size_t> dis(0, 3 * N);
+    vector<UInt> values;
+    for (int round = 0; round < 8; ++round) {
+        values.resize(dis(gen));
+        stdext::generate_random(values.begin(), values.end(), bulk);
+        for (const auto& value : values) {
+            const UInt expected = reference();
+            assert(engine() == expected);
+            assert(value == expected);
+        }
+    }
+
+    assert(engine == bulk);
+}
+
+void test_mersenne_twister(mt19937_64& gen) {
+    test_mersenne_twister_params<uint32_t, 32, 624, 397, 31, 0x9908b0df, 11, 0xffffffff, 7, 0x9d2c5680, 15, 0xefc60000,
+        18, 1812433253>(gen); // mt19937
+    test_mersenne_twister_params<uint64_t, 64, 312, 156, 31, 0xb5026f5aa96619e9, 29, 0x5555555555555555, 17,
+        0x71d67fffeda60000, 37, 0xfff7eee000000000, 43, 6364136223846793005>(gen); // mt19937_64
+
+    // narrower words, and states too short for the far input to fill a whole vector
+    test_mersenne_twister_params<uint32_t, 31, 17, 3, 13, 0x1908b0df, 11, 0x7fffffff, 7, 0x1d2c5680, 15, 0x6fc60000, 18,
+        1812433253>(gen);
+    test_mersenne_twister_params<uint32_t, 32, 17, 13, 31, 0x9908b0df, 11, 0xffffffff, 7, 0x9d2c5680, 15, 0xefc60000,
+        18, 1812433253>(gen);
+    test_mersenne_twister_params<uint64_t, 48, 5, 2, 20, 0x6f5aa96619e9, 29, 0x555555555555, 17, 0x7fffeda60000, 37,
+        0xf7eee0000000, 43, 0x136223846793>(gen);
+    test_mersenne_twister_params<uint64_t, 64, 2, 1, 31, 0xb5026f5aa96619e9, 29, 0x5555555555555555, 17,
+        0x71d67fffeda60000, 37, 0xfff7eee000000000, 43, 6364136223846793005>(gen);
+
+    // _Mx == _Nx isn't vectorized
+    test_mersenne_twister_params<uint32_t, 32, 9, 9, 31, 0x9908b0df, 11, 0xffffffff, 7, 0x9d2c5680, 15, 0xefc60000, 18,
+        1812433253>(gen);
+}
+
 void test_various_containers() {
     test_one_container<vector<int>>(); // contiguous, vectorizable
     test_one_container<deque<int>>(); // random-access, not vectorizable
@@ -1816,5 +2216,8 @@ int main() {
         test_various_containers();
         test_bitset(gen);
         test_string(gen);
+        test_ascii_case(gen);
+        test_utf_transcoding(gen);
+        test_mersenne_twister(gen);
     });
 }
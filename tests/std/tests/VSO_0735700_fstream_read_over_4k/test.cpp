@@ -5,8 +5,10 @@
 #include <cassert>
 #include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <numeric>
 #include <string>
+#include <vector>
 
 using namespace std;
 
@@ -25,7 +27,15 @@ string get_alphabet_repeats(const size_t targetLength) {
     return expected;
 }
 
-void run_test(const string& expected, const ios::openmode mode) {
+void open_for_reading(ifstream& file, const ios::openmode mode, const bool mapped) {
+    if (mapped) {
+        assert(stdext::open_mapped(*file.rdbuf(), "testing.txt"));
+    } else {
+        file.open("testing.txt", mode);
+    }
+}
+
+void run_test(const string& expected, const ios::openmode mode, const bool mapped = false) {
     const auto expectedSize = static_cast<ptrdiff_t>(expected.size());
     {
         ofstream file("testing.txt", ios::trunc | mode);
@@ -36,7 +46,8 @@ void run_test(const string& expected, const ios::openmode mode) {
     {
         const auto readAmount = expectedSize + 100;
         string result(static_cast<size_t>(readAmount), '\xFF');
-        ifstream file("testing.txt", mode);
+        ifstream file;
+        open_for_reading(file, mode, mapped);
         file.read(&result[0], readAmount);
         assert(file.eof());
         assert(!file.bad());
@@ -49,6 +60,115 @@ void run_test(const string& expected, const ios::openmode mode) {
     remove("testing.txt");
 }
 
+void test_mapped_seek() {
+    const string expected = get_alphabet_repeats(10000);
+    {
+        ofstream file("testing.txt", ios::binary);
+        file.write(expected.data(), static_cast<streamsize>(expected.size()));
+        assert(file.good());
+    }
+
+    {
+        ifstream file;
+        assert(stdext::open_mapped(*file.rdbuf(), "testing.txt"));
+        assert(file.rdbuf()->in_avail() == static_cast<streamsize>(expected.size()));
+
+        string line;
+        getline(file, line, 'z');
+        assert(line == expected.substr(0, 25));
+        assert(file.tellg() == 26);
+
+        file.seekg(-3, ios::end);
+        assert(file.tellg() == static_cast<streamoff>(expected.size() - 3));
+        assert(file.get() == expected[expected.size() - 3]);
+
+        file.seekg(5000);
+        assert(file.get() == expected[5000]);
+        assert(file.unget());
+        assert(file.get() == expected[5000]);
+
+        file.seekg(-1, ios::beg);
+        assert(file.fail());
+        file.clear();
+        assert(file.tellg() == 5001);
+
+        file.seekg(0);
+        assert(!file.unget());
+        file.clear();
+        file.seekg(0);
+        string result(istreambuf_iterator<char>{file}, istreambuf_iterator<char>{});
+        assert(result == expected);
+
+        // reading continues past the mapping through the C stream, which is at the end of the file
+        assert(file.get() == char_traits<char>::eof());
+
+        ifstream moved = move(file);
+        moved.clear();
+        moved.seekg(26);
+        assert(moved.get() == expected[26]);
+        assert(!file.is_open());
+
+        // the mapping belongs to the filebuf; after reopening without it, the C stream's buffer is used again
+        char buffer[100];
+        assert(!moved.rdbuf()->pubsetbuf(buffer, sizeof(buffer)));
+        moved.close();
+        moved.open("testing.txt", ios::binary);
+        assert(moved.rdbuf()->pubsetbuf(buffer, sizeof(buffer)));
+        moved.seekg(26);
+        assert(moved.get() == expected[26]);
+    }
+
+    {
+        ifstream file;
+        assert(stdext::open_mapped(*file.rdbuf(), "testing.txt"));
+        file.seekg(0, ios::end);
+        assert(file.tellg() == static_cast<streamoff>(expected.size()));
+        file.seekg(-1, ios::cur);
+        assert(file.get() == expected.back());
+    }
+
+    remove("testing.txt");
+}
+
+void test_getline_across_buffers(
+    const ios::openmode mode, const bool mapped = false, const streamsize write_buffer = 0) {
+    vector<string> lines;
+    for (size_t length = 0; length < 10000; length = length * 2 + 1) {
+        lines.push_back(get_alphabet_repeats(length));
+    }
+
+    {
+        ofstream file("testing.txt", ios::trunc | mode);
+        if (write_buffer != 0) { // a larger C stream buffer, allocated by the CRT
+            assert(file.rdbuf()->pubsetbuf(nullptr, write_buffer));
+        }
+
+        for (const auto& line : lines) {
+            file << line << '\n';
+        }
+
+        file << "unterminated";
+        assert(file.good());
+    }
+
+    {
+        ifstream file;
+        open_for_reading(file, mode, mapped);
+        string line;
+        for (const auto& expected : lines) {
+            assert(getline(file, line));
+            assert(line == expected);
+        }
+
+        assert(getline(file, line));
+        assert(line == "unterminated");
+        assert(file.eof());
+        assert(!getline(file, line));
+    }
+
+    remove("testing.txt");
+}
+
 int main() {
     string testCase = get_alphabet_repeats(8192);
     run_test(testCase, ios::openmode{});
@@ -59,4 +179,12 @@ int main() {
     testCase.assign(8100, '\n');
     run_test(testCase, ios::openmode{});
     run_test(testCase, ios::binary);
+    run_test(testCase, ios::binary, true);
+
+    test_mapped_seek();
+
+    test_getline_across_buffers(ios::openmode{});
+    test_getline_across_buffers(ios::binary);
+    test_getline_across_buffers(ios::binary, true);
+    test_getline_across_buffers(ios::binary, false, 0x10000);
 }